@@ -5,7 +5,11 @@
  * 
  * Technical Implementation: Console-based simulation of rotational selection mechanism
  * Target Environment: Universal C++ compilers and online IDE platforms
- * Dependency Requirements: Standard C++ libraries only
+ * Dependency Requirements: Standard C++ libraries, plus optional platform headers behind guards:
+ *   <sys/random.h> getrandom (Linux; secure seeding falls back to random_device),
+ *   <pthread.h> pthread_atfork (POSIX; post-fork reseeding is skipped elsewhere),
+ *   <sys/stat.h> / <direct.h> mkdir (POSIX / Windows; recording and image output directories)
+ * Nothing beyond these headers is required; OS-specific services such as io_uring stay out of scope
  */
 
 #include <iostream>     // Stream input/output operations for user interface
@@ -15,33 +19,718 @@
 #include <iomanip>      // Input/output stream formatting utilities
 #include <algorithm>    // Standard algorithms for data processing
 #include <chrono>       // Time-based operations for seed generation
+#include <cstdint>      // Fixed-width integer types for counter-based generation
+#include <cstdlib>      // Numeric conversion of command-line parameters
+#include <cmath>        // Logarithms and square roots for binomial sampling
+#include <sstream>      // Tokenization of interactive session commands
+#include <cstring>      // Raw label copies into inline small-wheel storage
+#include <thread>       // Background producer threads for random prefill
+#include <atomic>       // Lock-free ring positions shared between threads
+#include <fstream>      // Option files and bulk key assignment streams
+#include <deque>        // Recent-winner history for cooldown constraints
+#include <map>          // Tag name to bitmap index
+#include <unordered_map> // Label lookup for Markov transition files
+#include <bitset>       // Portable population counts for bitmap containers
+#include <functional>   // Recursive tag expression parser and parallel task bodies
+#include <array>        // Per-worker radix histograms
+#include <numeric>      // Option weight totals for the effective draw model
+
+#include <mutex>        // One-time registration of the fork handler
+#include <condition_variable> // Parking the prefill producer while its ring is full
+#include <cerrno>       // Existing-directory detection when creating output directories
+#include <sys/stat.h>   // mkdir/stat for recording output directories
+
+#if defined(_WIN32)
+#include <direct.h>     // _mkdir for recording output directories
+#endif
+
+#if defined(__linux__)
+#include <sys/random.h> // Kernel entropy for secure-mode seeding
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>    // pthread_atfork hook for post-fork reseeding
+#endif
 
 using namespace std;
 
+/*
+ * Session configuration structure describing the randomization source of a run
+ * Counter-based mode makes every spin a pure function of (seed, wheel id, spin number)
+ */
+struct wheel_session_configuration {
+    bool counter_based_mode = false;        // Philox4x32-10 counter-based spins instead of MT19937
+    uint64_t session_seed = 0;              // Key of the counter-based generator
+    uint64_t spin_number = 0;               // Counter value of the spin to execute
+    bool audit_only = false;                // Recompute the requested spin without the full report
+    uint64_t aggregate_spin_count = 0;      // Spins tallied by multinomial sampling (0 disables)
+    bool interactive_session = false;       // Keep the compiled wheel resident for repeated commands
+    bool benchmark_suite = false;           // Run the performance benchmarks instead of a decision
+    size_t prefill_ring_size = 0;           // Random words buffered by a producer thread (0 disables)
+    uint64_t load_request_count = 0;        // Requests issued per load-generator thread (0 disables)
+    size_t load_thread_count = 1;           // Concurrent load-generator clients
+    uint64_t load_request_rate = 0;         // Open-loop requests per second per thread (0 = closed loop)
+    size_t load_option_count = 8;           // Options on the synthetic load-test wheel
+    vector<uint64_t> load_spin_mix{1};      // Spins per request, cycled across requests
+    bool secure_mode = false;               // OS-seeded ChaCha20 instead of MT19937
+    string options_file_path;               // Options loaded from file instead of interactive entry
+    string key_input_path;                  // Bulk key assignment input (one key per line)
+    string key_output_path;                 // Bulk key assignment output (key<TAB>option per line)
+    size_t cooldown_length = 0;             // Spins an option must sit out after winning (0 disables)
+    bool fair_rotation = false;             // Deterministic weighted rotation instead of random draws
+    string markov_file_path;                // Transition weights conditioning each draw on the previous one
+    size_t markov_chain_count = 4096;       // Independent chains in the Markov analysis
+    uint64_t markov_step_count = 256;       // Steps simulated per chain
+    bool full_shuffle = false;              // Report a complete random ordering instead of one winner
+    bool weighted_shuffle = false;          // Order by weighted draws without replacement
+    bool physics_mode = false;              // Decide by a simulated physical spin of weighted sectors
+    uint64_t physics_batch_count = 0;       // Spins simulated by the batch physics check (0 disables)
+    string recording_path;                  // Rotation animation exported as a .cast file or frame directory
+    uint64_t recording_clip_count = 0;      // Replay clips rendered for consecutive spins (0 records this run)
+    string render_path;                     // Wheel image (.qoi or PPM) or image directory for batches
+    uint64_t render_image_count = 0;        // Images rendered for consecutive spins (0 renders this run)
+};
+
+// Decay epochs end once the boost scale reaches this bound and stored boosts are renormalized
+const double DECAY_RENORMALIZATION_BOUND = 1e18;
+
+/*
+ * Decaying wheel structure implementing lazily aged boosts over static base weights
+ * Effective weight is base_i + stored_i * exp(-rate * (now - epoch)). Boosts are stored
+ * pre-scaled by exp(rate * (t - epoch)), so time passing touches no option at all; a spin
+ * picks the base or boost tree by total mass, then descends that tree in O(log n)
+ */
+struct decaying_wheel {
+    vector<double> base_weights;            // Non-decaying configured weights
+    vector<double> base_tree;               // Fenwick tree over base_weights
+    double base_total = 0.0;                // Sum of base weights
+    vector<double> stored_boosts;           // Boosts in epoch-scaled units
+    vector<double> boost_tree;              // Fenwick tree over stored_boosts
+    double stored_boost_total = 0.0;        // Sum of stored boosts (epoch-scaled)
+    double decay_rate = 0.0;                // Exponential rate per second (ln 2 / half-life)
+    double epoch_time = 0.0;                // Time at which stored units equal real units
+    double current_time = 0.0;              // Latest clock value seen by the wheel
+};
+
+// Roaring-style containers switch from sorted arrays to 65536-bit bitsets above this cardinality
+const uint32_t BITMAP_ARRAY_LIMIT = 4096;
+const size_t BITMAP_BITSET_WORDS = 1024;
+
+/*
+ * Bitmap container structure covering one 65536-value chunk of option indices
+ * Sparse chunks keep sorted 16-bit offsets; dense chunks keep a 1024-word bitset
+ */
+struct bitmap_container {
+    uint16_t high_key = 0;                  // Upper 16 bits shared by every value in the chunk
+    uint32_t cardinality = 0;               // Number of values present
+    vector<uint16_t> sorted_values;         // Array form (cardinality <= 4096)
+    vector<uint64_t> bitset_words;          // Bitset form (cardinality > 4096)
+};
+
+/*
+ * Compressed bitmap structure implementing a roaring-style set of option indices
+ */
+struct compressed_bitmap {
+    vector<bitmap_container> containers;    // Sorted by high_key, empty containers removed
+};
+
+// Set operations supported between compressed bitmaps
+enum class bitmap_operation { intersection, union_all, difference };
+
+/*
+ * Tag index structure mapping every tag to the bitmap of options carrying it
+ */
+struct tag_index {
+    map<string, compressed_bitmap> tag_bitmaps;     // Options per tag
+    compressed_bitmap all_options;                  // Universe used by NOT
+};
+
+/*
+ * Filtered selection structure implementing weighted rank/select over a bitmap
+ * Prefix weights are kept per container and per array slot or bitset word, so a spin
+ * narrows to one 64-option word in two binary searches without copying the options
+ */
+struct filtered_selection_index {
+    compressed_bitmap matching_options;             // Result of the tag expression
+    vector<double> container_cumulative;            // Inclusive weight prefix per container
+    vector<vector<double>> slot_cumulative;         // Inclusive prefix per value (array) or word (bitset)
+    double total_weight = 0.0;                      // Weight of all matching options
+};
+
+// Bandit policies available to adaptive session wheels
+enum class bandit_policy { disabled, thompson_sampling, upper_confidence_bound };
+
+/*
+ * Bandit state structure holding per-option Beta posteriors and pull statistics
+ * Rewards in [0, 1] update the posterior in O(1): alpha += r, beta += 1 - r
+ */
+struct bandit_state {
+    vector<double> success_mass;            // Beta alpha parameters (prior 1)
+    vector<double> failure_mass;            // Beta beta parameters (prior 1)
+    vector<uint64_t> pull_counts;           // Rewards reported per option
+    vector<double> reward_sums;             // Accumulated reward per option
+    uint64_t total_pulls = 0;               // Rewards reported across all options
+};
+
+/*
+ * Fair rotation structure implementing stride scheduling over a binary min-heap
+ * Each option advances its pass by 1 / weight when chosen; the smallest pass goes next,
+ * so every window of picks tracks the weights with bounded discrepancy
+ */
+struct fair_rotation_scheduler {
+    vector<double> option_strides;              // Pass increment per option (1 / weight)
+    vector<uint64_t> option_pick_counts;        // Picks granted per option; pass = (picks + 1/2) * stride
+    vector<pair<double, size_t>> pass_heap;     // (pass, option index), smallest pass on top
+};
+
+// Fenwick updates tolerated before the tree is rebuilt to cancel floating-point drift
+const uint64_t COOLDOWN_REBUILD_INTERVAL = 1 << 20;
+
+/*
+ * Cooldown sampler structure implementing no-repeat selection over a Fenwick tree
+ * Recent winners have their weight zeroed in the tree, so each pick stays O(log n)
+ * no matter how many options are currently excluded
+ */
+struct cooldown_sampler {
+    vector<double> base_weights;            // Configured weight per option
+    vector<double> fenwick_tree;            // One-based binary indexed tree of active weights
+    deque<size_t> recent_winners;           // Excluded options, oldest first
+    vector<uint8_t> exclusion_flags;        // O(1) membership test for recent_winners
+    size_t cooldown_length = 0;             // Effective exclusion window
+    double active_total = 0.0;              // Sum of weights currently eligible
+    uint64_t updates_since_rebuild = 0;     // Drift control counter
+};
+
+// Bulk key assignment processes the input in newline-aligned chunks of this size
+const size_t KEY_ASSIGNMENT_CHUNK_BYTES = 4 << 20;
+
+// ChaCha20 blocks generated per refill; lanes are interleaved for SIMD execution
+const size_t CHACHA20_PARALLEL_BLOCKS = 4;
+const size_t CHACHA20_BUFFER_WORDS = CHACHA20_PARALLEL_BLOCKS * 8;
+
+/*
+ * Secure generator structure holding ChaCha20 key material and buffered output
+ * Four blocks are produced per refill so the permutation cost is amortized over 32 words
+ */
+struct chacha20_generator {
+    uint32_t input_state[16];                       // Constants, 256-bit key, 64-bit counter, nonce
+    uint64_t buffered_words[CHACHA20_BUFFER_WORDS]; // Keystream awaiting consumption
+    size_t buffer_position = CHACHA20_BUFFER_WORDS; // Next unread word; full means empty
+};
+
+// HDR histogram layout: 2048 linear sub-buckets per power of two (3 significant digits)
+const uint64_t HISTOGRAM_SUB_BUCKET_COUNT = 2048;
+const uint64_t HISTOGRAM_SUB_BUCKET_HALF = 1024;
+const uint64_t HISTOGRAM_MAGNITUDE_COUNT = 40;
+
+/*
+ * Latency histogram structure implementing HDR-style log-linear bucketing
+ * Values are nanoseconds; relative bucket error stays below 0.1% across the range
+ */
+struct latency_histogram {
+    vector<uint64_t> bucket_counts = vector<uint64_t>(HISTOGRAM_SUB_BUCKET_COUNT + HISTOGRAM_MAGNITUDE_COUNT * HISTOGRAM_SUB_BUCKET_HALF, 0);
+    uint64_t total_count = 0;               // Number of recorded values
+    uint64_t maximum_value = 0;             // Exact largest recorded value
+};
+
+/*
+ * Prefill ring structure implementing a single-producer single-consumer word queue
+ * A background thread keeps the ring full so spins only pop a ready random word;
+ * once full, the producer sleeps until the consumer drains it to the low-water mark
+ */
+struct random_prefill_ring {
+    vector<uint64_t> ring_slots;                    // Power-of-two sized word storage
+    size_t capacity_mask = 0;                       // Slot count minus one for index wrapping
+    uint64_t low_water_mark = 0;                    // Buffered words at or below which the producer wakes
+    alignas(64) atomic<uint64_t> write_position{0}; // Advanced only by the producer thread
+    alignas(64) atomic<uint64_t> read_position{0};  // Advanced only by the consumer
+    alignas(64) atomic<bool> stop_requested{false}; // Producer shutdown signal
+    atomic<bool> producer_waiting{false};           // Producer is parked on the wakeup condition
+    mutex producer_mutex;                           // Guards the producer's sleep and wakeup
+    condition_variable producer_wakeup;             // Signalled at the low-water mark and on shutdown
+    thread producer_thread;                         // Background generator thread
+    mt19937_64 fallback_generator;                  // Consumer-side source when the ring runs dry
+};
+
+// Inline small-wheel capacity limits covering the common interactive wheel sizes
+const size_t SMALL_WHEEL_CAPACITY = 16;
+const size_t SMALL_WHEEL_LABEL_BYTES = 512;
+const uint32_t SMALL_WHEEL_THRESHOLD_SCALE = 0x80000000u;
+
+/*
+ * Small wheel structure storing up to 16 options without any heap allocation
+ * The 31-bit interval starts occupy exactly the first cache line, so a spin touches
+ * a single line; labels follow back to back and are read from here when a winner is shown
+ */
+struct alignas(64) small_wheel {
+    uint32_t interval_starts[SMALL_WHEEL_CAPACITY];         // Lower bound of each option's interval
+    uint8_t option_count = 0;                               // Number of occupied slots
+    uint16_t label_offsets[SMALL_WHEEL_CAPACITY + 1];       // Start of each label; the next entry ends it
+    char label_bytes[SMALL_WHEEL_LABEL_BYTES];              // Packed, unterminated label bytes
+};
+
+/*
+ * Compiled wheel structure holding options together with their selection table
+ * Session commands edit this structure in place instead of re-collecting input
+ */
+struct compiled_wheel {
+    vector<string> choice_container;        // Option labels in wheel order
+    vector<double> option_weights;          // Relative selection weight per option
+    vector<double> cumulative_weights;      // Prefix sums searched during selection
+    double total_weight = 0.0;              // Sum of all option weights
+    uint64_t wheel_identifier = 0;          // FNV-1a identifier of the option labels
+    vector<uint64_t> option_key_seeds;      // Label hashes used by keyed rendezvous assignment
+    bool uses_small_wheel = false;          // Spins are served from the inline table below
+    small_wheel inline_table;               // Heap-free selection table for wheels of up to 16 options
+};
+
+// Effective draw model shared by the live spin, audits, clips, images and every report of one wheel
+struct effective_draw_model {
+    bool weighted_draw = false;             // Draws follow unequal option weights instead of the uniform mapping
+    bool uniform_outcome = true;            // Every option is equally likely to be the final pick
+    string model_label;                     // Outcome model named in the reports
+    vector<double> option_probabilities;    // Probability (long-run share for stateful modes) of each final pick
+    compiled_wheel draw_wheel;              // Prefix sums serving weighted draws
+};
+
+// Generator lifecycle counters: fork generations invalidate every thread-local generator
+atomic<uint64_t> fork_generation_counter{0};
+atomic<uint64_t> generator_stream_counter{0};
+
+/*
+ * Thread-local generator slot holding a lazily seeded MT19937-64 instance
+ * The recorded fork generation detects state inherited from a parent process
+ */
+struct thread_generator_slot {
+    mt19937_64 random_generator;            // Per-thread generator, never shared across threads
+    uint64_t seeded_fork_generation = 0;    // Fork generation observed when last seeded
+    bool is_seeded = false;                 // Lazy initialization flag
+};
+
+// Counter lanes separating the final selection from the cosmetic rotation phases
+const uint32_t FINAL_SELECTION_LANE = 0;
+const uint32_t ROTATION_PHASE_LANE_BASE = 1;
+
+// Markov analysis chains draw from their own counter stream; chains advance in lock-step batches
+const uint64_t MARKOV_CHAIN_STREAM = 0x4D41524B4F56ULL;
+const size_t MARKOV_CHAIN_BATCH = 16;
+
+// MergeShuffle shuffles fixed 64K-element blocks, then merges pairs level by level;
+// block boundaries depend only on the list length so any thread count gives the same order
+const uint64_t MERGE_SHUFFLE_STREAM = 0x53485546464C45ULL;
+const size_t MERGE_SHUFFLE_BLOCK_LENGTH = 65536;
+
+// Weighted orderings draw exponential keys in independently seeded blocks of options
+const uint64_t WEIGHTED_ORDER_STREAM = 0x5745494748544544ULL;
+const size_t WEIGHTED_ORDER_BLOCK_LENGTH = 65536;
+
+// Physical wheel units: one turn is 2^32 angle units, time advances in fixed 1/240 s steps.
+// Launch speeds span 2-5 turns/s and friction removes 0.75 turns/s every second
+const uint64_t PHYSICS_ANGLE_UNITS_PER_TURN = 1ULL << 32;
+const int64_t PHYSICS_STEPS_PER_SECOND = 240;
+const int64_t PHYSICS_MIN_LAUNCH_VELOCITY = 35791394;     // 2 turns/s in units per step
+const int64_t PHYSICS_MAX_LAUNCH_VELOCITY = 89478485;     // 5 turns/s in units per step
+const int64_t PHYSICS_FRICTION_PER_STEP = 55924;          // 0.75 turns/s^2 in units per step^2
+
+// Sector lookup table: at least two buckets per sector keeps the per-bucket fix-up list
+// near one boundary; longer lists (very uneven weights) fall back to a bounded binary search
+const size_t PHYSICS_MIN_LOOKUP_BUCKETS = 64;
+const size_t PHYSICS_MAX_LOOKUP_BUCKETS = 1 << 20;
+const size_t PHYSICS_BUCKET_SCAN_LIMIT = 8;
+
+/*
+ * Physical wheel structure holding sector geometry derived from option weights
+ * Sector i spans [sector_starts[i], sector_starts[i + 1]) in 32-bit angle units.
+ * The angle circle is also cut into 2^k equal buckets; bucket_sectors[b] is the sector
+ * under the bucket's first angle, so the sectors beginning inside bucket b are exactly
+ * bucket_sectors[b] + 1 .. bucket_sectors[b + 1] - its fix-up list
+ */
+struct physical_wheel {
+    vector<uint32_t> sector_starts;         // Start angle of every sector; the first starts at 0
+    vector<uint32_t> bucket_sectors;        // Sector at each bucket start, plus the sector at the last angle
+    uint32_t bucket_shift = 32;             // Angle bits dropped to reach the bucket index
+};
+
+/*
+ * Physical spin state advanced by the fixed-step integrator
+ * Integer state keeps integration and the closed form bit-identical on every platform
+ */
+struct physical_spin_state {
+    uint64_t wheel_angle = 0;               // Accumulated rotation (mod 2^32 is the visible angle)
+    int64_t angular_velocity = 0;           // Units per step; zero once the wheel rests
+    uint64_t elapsed_steps = 0;             // Integration steps taken so far
+};
+
+// Batch physics steps this many wheels together in fixed groups of eight lanes;
+// pegs at sector boundaries model pointer contact
+const size_t PHYSICS_BATCH_LANES = 4096;
+const size_t PHYSICS_LANE_GROUP = 8;
+
+/*
+ * Peg model structure describing the pointer hitting a peg at every sector boundary
+ * A wheel slower than the clearance velocity rebounds and rests before the peg;
+ * a faster wheel passes and loses the impulse
+ */
+struct peg_configuration {
+    const char* model_label;                // Name shown in reports
+    bool pegs_enabled;                      // False reproduces the frictionless-pointer model
+    int64_t peg_impulse;                    // Velocity lost per peg passed (units per step)
+    int64_t clearance_velocity;             // Minimum velocity that carries the wheel over a peg
+};
+
+/*
+ * Lane group structure implementing structure-of-arrays state for eight wheels
+ * Every field is an eight-lane array, so a fixed-length loop over one group compiles to
+ * vector instructions on baseline SSE2 and the fields provably never alias each other
+ */
+struct physical_lane_group {
+    uint32_t wheel_angles[PHYSICS_LANE_GROUP];          // Visible angle (wraps once per turn)
+    int32_t angular_velocities[PHYSICS_LANE_GROUP];     // Units per step
+    uint32_t peg_gaps[PHYSICS_LANE_GROUP];              // Distance to the next boundary ahead, minus one
+};
+
+/*
+ * Batch physics structure holding lane groups plus the cold per-lane bookkeeping
+ * Moving wheels occupy lanes [0, active_lane_count) and only their groups are stepped.
+ * Lanes are filled fastest wheel first, so without pegs wheels stop from the tail;
+ * with pegs a stopped wheel is retired and the last moving wheel swapped into its lane
+ */
+struct physical_spin_batch {
+    vector<physical_lane_group> lane_groups;    // Hot state stepped every iteration
+    vector<uint32_t> next_peg_sectors;          // Sector that each lane's next boundary opens
+    vector<uint32_t> lane_spins;                // Launch index of the wheel in each lane
+    vector<uint32_t> resting_angles;            // Final angle per launch index, written on retirement
+    vector<uint8_t> group_events;               // Last step per group: bit 0 peg reached, bit 1 wheel stopped
+    size_t active_lane_count = 0;               // Lanes still holding a moving wheel
+};
+
+// Group event bits raised by the vector step and resolved in the scalar passes
+const uint32_t PHYSICS_EVENT_PEG_CROSSING = 1;
+const uint32_t PHYSICS_EVENT_WHEEL_STOPPED = 2;
+
+// Recording timeline: unphysical phases advance at a fixed synthetic pace and the result
+// is held on screen briefly; casts declare a standard 80x24 terminal
+const double RECORDING_PHASE_SECONDS = 0.5;
+const double RECORDING_RESULT_HOLD_SECONDS = 2.0;
+const int RECORDING_TERMINAL_WIDTH = 80;
+const int RECORDING_TERMINAL_HEIGHT = 24;
+
+/*
+ * Recording structure holding terminal output events on a synthetic clock
+ * Nothing ever sleeps: each event carries the time at which a real-time run would show it
+ */
+struct spin_recording {
+    vector<double> event_times;             // Seconds since the start of the clip
+    vector<string> event_texts;             // Output emitted at that time ('\n' line breaks)
+};
+
+// Wheel images: the wheel sits under a fixed pointer at 12 o'clock with a caption below.
+// Spans are filled from a 16-pixel (48-byte, three 16-byte vectors) colour pattern
+const int RASTER_IMAGE_WIDTH = 512;
+const int RASTER_IMAGE_HEIGHT = 576;
+const int RASTER_WHEEL_CENTER_X = 256;
+const int RASTER_WHEEL_CENTER_Y = 268;
+const int RASTER_WHEEL_RADIUS = 220;
+const int RASTER_RIM_WIDTH = 4;
+const int RASTER_HUB_RADIUS = 18;
+const size_t RASTER_FILL_CHUNK_PIXELS = 16;
+
+/*
+ * RGB colour and image structures for the software rasterizer
+ */
+struct raster_color {
+    uint8_t red, green, blue;
+};
+
+struct raster_image {
+    int image_width = 0;
+    int image_height = 0;
+    vector<uint8_t> rgb_pixels;             // Row-major, three bytes per pixel
+};
+
+// Sector palette (pastel, so dark labels stay readable) and fixed drawing colours
+const raster_color RASTER_SECTOR_PALETTE[] = {
+    {244, 143, 131}, {255, 204, 128}, {255, 241, 150}, {197, 225, 165}, {128, 222, 234}, {144, 202, 249},
+    {179, 157, 219}, {244, 166, 203}, {188, 170, 164}, {165, 214, 167}, {255, 171, 145}, {159, 168, 218}
+};
+const size_t RASTER_PALETTE_SIZE = sizeof(RASTER_SECTOR_PALETTE) / sizeof(RASTER_SECTOR_PALETTE[0]);
+const raster_color RASTER_BACKGROUND_COLOR = {250, 250, 246};
+const raster_color RASTER_OUTLINE_COLOR = {48, 48, 56};
+const raster_color RASTER_POINTER_COLOR = {200, 32, 44};
+const raster_color RASTER_TEXT_COLOR = {24, 24, 28};
+
+// Built-in 5x7 bitmap font: one row per byte, bit 4 is the leftmost column. Lower case
+// is drawn as upper case and unknown characters as a hollow box
+const char BITMAP_FONT_CHARACTERS[] = " 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-.!?:'_/#";
+const uint8_t BITMAP_FONT_ROWS[][7] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, {0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11},
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}, {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}, {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}, {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}, {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}, {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}, {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}, {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}, {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}, {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04},
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}, {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04},
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00},
+    {0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F},
+    {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10}, {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}
+};
+const uint8_t BITMAP_FONT_UNKNOWN_GLYPH[7] = {0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F};
+
+// 11-bit digits sort 64-bit keys in six passes with histograms that stay in L1
+const int RADIX_DIGIT_BITS = 11;
+const size_t RADIX_BUCKET_COUNT = size_t(1) << RADIX_DIGIT_BITS;
+
+/*
+ * Ordering key structure pairing an exponential key with its option
+ * Positive IEEE doubles order like their bit patterns, so keys sort as integers
+ */
+struct ordering_key_entry {
+    uint64_t key_bits;                      // Bit pattern of -ln(U) / weight
+    uint32_t option_index;                  // Option carrying the key
+};
+
+/*
+ * Markov wheel structure storing transition weights as a sparse CSR matrix
+ * Every row carries its own alias table over its non-zero entries, so a step is
+ * one random word, one table slot and at most one alias redirect. Rows without
+ * entries fall back to the uniform wheel
+ */
+struct markov_wheel {
+    vector<uint64_t> row_offsets;               // CSR row starts (option count + 1 entries)
+    vector<uint32_t> column_indices;            // Destination option of each stored transition
+    vector<double> transition_probabilities;    // Row-normalized probability of each transition
+    vector<double> alias_thresholds;            // Probability of keeping the slot's own destination
+    vector<uint32_t> alias_columns;             // Destination taken when the slot is not kept
+};
+
 // Function prototype declarations for modular architecture
+bool parse_command_line_options(int argument_count, char* argument_values[], wheel_session_configuration& session_configuration);
 void display_program_header();
 void collect_user_choices(vector<string>& choice_container);
-void execute_wheel_simulation(const vector<string>& choice_container);
-void display_statistical_analysis(const vector<string>& choice_container, const string& selected_choice);
-void display_visual_wheel_representation(const vector<string>& choice_container, int selected_index);
+bool load_options_file(const string& file_path, vector<string>& choice_container, vector<double>& option_weights, vector<vector<string>>& option_tags);
+uint64_t compute_wheel_identifier(const vector<string>& choice_container);
+uint64_t generate_counter_based_word(uint64_t session_seed, uint64_t wheel_identifier, uint64_t spin_number, uint32_t draw_lane);
+uint64_t map_random_word_to_index(uint64_t random_word, uint64_t index_range);
+size_t compute_counter_based_spin(uint64_t session_seed, uint64_t wheel_identifier, uint64_t spin_number, size_t option_count);
+void build_effective_draw_model(effective_draw_model& draw_model, const vector<string>& choice_container, const vector<double>& option_weights,
+                                const markov_wheel* transition_model, const wheel_session_configuration& session_configuration);
+size_t select_effective_draw_index(const effective_draw_model& draw_model, uint64_t random_word);
+void execute_counter_based_audit(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration);
+void handle_fork_in_child_process();
+mt19937_64& acquire_thread_local_generator();
+void execute_wheel_simulation(const vector<string>& choice_container, const vector<double>& option_weights,
+                              const markov_wheel& transition_model, const wheel_session_configuration& session_configuration);
+uint64_t sample_binomial_variate(uint64_t trial_count, double success_probability, mt19937_64& random_generator);
+vector<uint64_t> sample_multinomial_counts(uint64_t total_spin_count, const vector<double>& option_probabilities, mt19937_64& random_generator);
+void display_statistical_analysis(const vector<string>& choice_container, const effective_draw_model& draw_model, int selected_index,
+                                  const wheel_session_configuration& session_configuration);
+void display_aggregate_tally_analysis(const vector<string>& choice_container, const effective_draw_model& draw_model,
+                                      const wheel_session_configuration& session_configuration);
+bool load_markov_wheel(const string& file_path, const vector<string>& choice_container, markov_wheel& transition_model);
+void build_markov_wheel(markov_wheel& transition_model, vector<vector<pair<uint32_t, double>>>& row_entries);
+size_t step_markov_wheel(const markov_wheel& transition_model, size_t current_option, uint64_t random_word);
+vector<double> compute_markov_stationary_distribution(const markov_wheel& transition_model, size_t& iteration_count);
+void execute_markov_chain_analysis(const vector<string>& choice_container, const markov_wheel& transition_model, const wheel_session_configuration& session_configuration);
+void run_parallel_tasks(size_t task_count, size_t worker_count, const function<void(size_t)>& task_body);
+void merge_shuffled_runs(vector<string>& choice_container, size_t run_start, size_t run_middle, size_t run_end, const function<uint64_t()>& next_random_word);
+void shuffle_options_in_parallel(vector<string>& choice_container, uint64_t shuffle_seed, size_t worker_count,
+                                 const chacha20_generator* secure_source = nullptr);
+void generate_exponential_keys(const vector<double>& option_weights, uint64_t ordering_seed, vector<ordering_key_entry>& key_entries, size_t worker_count,
+                               const chacha20_generator* secure_source = nullptr);
+void radix_sort_key_entries(vector<ordering_key_entry>& key_entries, size_t worker_count);
+vector<uint32_t> compute_weighted_ordering(const vector<double>& option_weights, uint64_t ordering_seed, size_t worker_count,
+                                           const chacha20_generator* secure_source = nullptr);
+void execute_full_shuffle(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration);
+void build_physical_wheel(physical_wheel& spin_wheel, const vector<double>& option_weights);
+physical_spin_state launch_physical_spin(uint64_t random_word);
+bool advance_physical_spin(physical_spin_state& spin_state);
+uint64_t count_remaining_physical_steps(const physical_spin_state& spin_state);
+uint32_t compute_stopping_angle(const physical_spin_state& spin_state);
+size_t locate_physical_sector(const physical_wheel& spin_wheel, uint32_t wheel_angle);
+void launch_physical_batch(physical_spin_batch& spin_batch, const physical_wheel& spin_wheel, const vector<uint64_t>& launch_words);
+bool step_physical_batch(physical_spin_batch& spin_batch, const physical_wheel& spin_wheel, const peg_configuration& peg_model);
+void retire_stopped_lanes(physical_spin_batch& spin_batch, size_t group_count);
+void display_physical_batch_analysis(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration);
+void append_rotation_clip(spin_recording& recording, const vector<string>& choice_container, const vector<int>& phase_indices,
+                          int final_index, uint64_t spin_duration_steps);
+string escape_json_text(const string& raw_text);
+bool create_output_directory(const string& directory_path);
+bool write_cast_recording(const spin_recording& recording, const string& output_path, const string& clip_title);
+bool write_frame_directory(const spin_recording& recording, const string& directory_path);
+bool save_spin_recording(const spin_recording& recording, const string& output_path, const string& clip_title);
+size_t render_counter_based_clip(const vector<string>& choice_container, const physical_wheel& spin_wheel, const effective_draw_model& draw_model,
+                                 const wheel_session_configuration& session_configuration, uint64_t spin_number, spin_recording& recording);
+void execute_clip_recording(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration);
+uint32_t compute_sector_center_angle(const physical_wheel& spin_wheel, size_t sector_index);
+void fill_raster_span(raster_image& image, int pixel_row, int span_start, int span_end, raster_color fill_color);
+void draw_bitmap_text(raster_image& image, int center_x, int top_y, const string& text, int glyph_scale, raster_color text_color);
+void render_wheel_image(raster_image& image, const vector<string>& choice_container, const physical_wheel& spin_wheel,
+                        uint32_t pointer_angle, size_t selected_index);
+size_t encode_qoi_image(const raster_image& image, vector<uint8_t>& encoded_buffer);
+bool write_raster_image(const raster_image& image, const string& output_path);
+void execute_image_rendering(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration);
+bool build_small_wheel(const vector<string>& choice_container, const vector<double>& option_weights, small_wheel& inline_wheel);
+size_t select_small_wheel_index(const small_wheel& inline_wheel, uint64_t random_word);
+string read_compiled_wheel_label(const compiled_wheel& wheel, size_t option_index);
+void compile_wheel(compiled_wheel& wheel);
+size_t select_compiled_wheel_index(const compiled_wheel& wheel, uint64_t random_word);
+uint64_t multiply_and_fold(uint64_t first_operand, uint64_t second_operand);
+uint64_t hash_selection_key(const char* key_data, size_t key_length, uint64_t hash_seed);
+size_t select_keyed_wheel_index(const compiled_wheel& wheel, uint64_t key_hash);
+void assign_keys_to_options(const compiled_wheel& wheel, const vector<string>& selection_keys, vector<uint32_t>& assigned_indices);
+void build_fenwick_tree(vector<double>& fenwick_tree, const vector<double>& option_values);
+void add_fenwick_value(vector<double>& fenwick_tree, size_t option_index, double value_delta);
+size_t find_fenwick_index(const vector<double>& fenwick_tree, double target_value);
+void initialize_cooldown_sampler(cooldown_sampler& sampler, const vector<double>& option_weights, size_t cooldown_length);
+void rebuild_cooldown_tree(cooldown_sampler& sampler);
+void adjust_cooldown_weight(cooldown_sampler& sampler, size_t option_index, double weight_delta);
+size_t draw_cooldown_index(cooldown_sampler& sampler, uint64_t random_word);
+void initialize_decaying_wheel(decaying_wheel& wheel, const vector<double>& base_weights, double half_life_seconds, double start_time);
+void advance_decaying_wheel(decaying_wheel& wheel, double elapsed_seconds);
+void boost_decaying_option(decaying_wheel& wheel, size_t option_index, double boost_amount);
+void set_decaying_base_weight(decaying_wheel& wheel, size_t option_index, double base_weight);
+double decayed_boost_value(const decaying_wheel& wheel, size_t option_index);
+double compute_decay_factor(const decaying_wheel& wheel);
+size_t select_decaying_index(const decaying_wheel& wheel, uint64_t random_word);
+void append_bitmap_value(compressed_bitmap& bitmap, uint32_t option_value);
+void normalize_bitmap_container(bitmap_container& container);
+bitmap_container combine_bitmap_containers(const bitmap_container& first_container, const bitmap_container& second_container, bitmap_operation operation);
+compressed_bitmap combine_bitmaps(const compressed_bitmap& first_bitmap, const compressed_bitmap& second_bitmap, bitmap_operation operation);
+uint64_t count_bitmap_values(const compressed_bitmap& bitmap);
+void build_tag_index(tag_index& index, const vector<vector<string>>& option_tags);
+bool evaluate_tag_expression(const string& expression_text, const tag_index& index, compressed_bitmap& result_bitmap);
+void build_filtered_selection(filtered_selection_index& selection, const compressed_bitmap& matching_options, const vector<double>& option_weights);
+size_t select_filtered_index(const filtered_selection_index& selection, const vector<double>& option_weights, uint64_t random_word);
+size_t select_filtered_target(const filtered_selection_index& selection, const vector<double>& option_weights, double target_weight);
+size_t select_filtered_decaying_index(const filtered_selection_index& base_selection, const filtered_selection_index& boost_selection,
+                                      const decaying_wheel& wheel, uint64_t random_word);
+void initialize_fair_rotation(fair_rotation_scheduler& scheduler, const vector<double>& option_weights);
+size_t next_fair_rotation_index(fair_rotation_scheduler& scheduler);
+void advance_fair_rotation(fair_rotation_scheduler& scheduler, uint64_t skipped_picks);
+void resize_bandit_state(bandit_state& state, size_t option_count);
+void record_bandit_reward(bandit_state& state, size_t option_index, double reward_value);
+void sample_gamma_batch(const vector<double>& shape_parameters, vector<double>& gamma_samples, const function<uint64_t()>& next_random_word);
+size_t select_bandit_index(const bandit_state& state, const vector<double>& option_weights, bandit_policy policy,
+                           const function<uint64_t()>& next_random_word);
+void execute_bulk_key_assignment(const compiled_wheel& wheel, const wheel_session_configuration& session_configuration);
+void execute_interactive_session(const vector<string>& choice_container, const vector<double>& option_weights,
+                                 const vector<vector<string>>& option_tags, const wheel_session_configuration& session_configuration);
+void execute_benchmark_suite();
+void start_random_prefill(random_prefill_ring& prefill_ring, size_t requested_size, uint64_t seed_value);
+uint64_t pop_prefilled_word(random_prefill_ring& prefill_ring);
+void stop_random_prefill(random_prefill_ring& prefill_ring);
+void display_latency_percentiles(const string& measurement_label, vector<double>& latency_samples);
+void record_latency_value(latency_histogram& histogram, uint64_t latency_value);
+void merge_latency_histograms(latency_histogram& target_histogram, const latency_histogram& source_histogram);
+uint64_t query_latency_percentile(const latency_histogram& histogram, double percentile_rank);
+void execute_load_generator(const wheel_session_configuration& session_configuration);
+void seed_chacha20_generator(chacha20_generator& secure_generator);
+void refill_chacha20_buffer(chacha20_generator& secure_generator);
+uint64_t next_chacha20_word(chacha20_generator& secure_generator);
+void fork_chacha20_generator(const chacha20_generator& secure_source, uint32_t stream_level, uint32_t stream_index, chacha20_generator& task_generator);
+void display_visual_wheel_representation(const vector<string>& choice_container, const effective_draw_model& draw_model, int selected_index);
 void display_program_conclusion();
 
 /*
  * Primary execution function implementing the main program workflow
  * This function orchestrates the entire decision wheel operation sequence
  */
-int main() {
+int main(int argc, char* argv[]) {
     // Initialize choice storage container using dynamic vector allocation
     vector<string> user_choice_container;
+    vector<double> user_weight_container;
+    vector<vector<string>> user_tag_container;
+    wheel_session_configuration session_configuration;
+    
+    // Interpret optional command-line switches before any interaction
+    if (!parse_command_line_options(argc, argv, session_configuration)) {
+        return 1;
+    }
     
     // Display professional program introduction and branding
     display_program_header();
     
+    // Benchmark mode measures the engine on synthetic wheels and skips collection
+    if (session_configuration.benchmark_suite) {
+        execute_benchmark_suite();
+        return 0;
+    }
+    
+    // Load-generator mode drives a synthetic wheel from concurrent clients
+    if (session_configuration.load_request_count > 0) {
+        execute_load_generator(session_configuration);
+        return 0;
+    }
+    
     // Execute user input collection phase with validation protocols
-    collect_user_choices(user_choice_container);
+    if (!session_configuration.options_file_path.empty()) {
+        if (!load_options_file(session_configuration.options_file_path, user_choice_container, user_weight_container, user_tag_container)) {
+            return 1;
+        }
+    } else {
+        collect_user_choices(user_choice_container);
+    }
+    
+    // Bulk mode streams a key file through the keyed selection logic
+    if (!session_configuration.key_input_path.empty()) {
+        compiled_wheel assignment_wheel;
+        assignment_wheel.choice_container = user_choice_container;
+        assignment_wheel.option_weights = user_weight_container;
+        compile_wheel(assignment_wheel);
+        execute_bulk_key_assignment(assignment_wheel, session_configuration);
+        return 0;
+    }
+    
+    // Audit mode recomputes a single spin directly from its counter value
+    if (session_configuration.audit_only) {
+        execute_counter_based_audit(user_choice_container, user_weight_container, session_configuration);
+        return 0;
+    }
+    
+    // Shuffle mode reports a complete random ordering instead of a single winner
+    if (session_configuration.full_shuffle || session_configuration.weighted_shuffle) {
+        execute_full_shuffle(user_choice_container, user_weight_container, session_configuration);
+        display_program_conclusion();
+        return 0;
+    }
+    
+    // Clip and image modes render replay recordings and wheel images for a range of spins
+    if (session_configuration.recording_clip_count > 0 || session_configuration.render_image_count > 0) {
+        if (session_configuration.recording_clip_count > 0) {
+            execute_clip_recording(user_choice_container, user_weight_container, session_configuration);
+        }
+        if (session_configuration.render_image_count > 0) {
+            execute_image_rendering(user_choice_container, user_weight_container, session_configuration);
+        }
+        display_program_conclusion();
+        return 0;
+    }
+    
+    // Markov wheels condition every draw on the previous outcome
+    markov_wheel user_transition_model;
+    if (!session_configuration.markov_file_path.empty() &&
+        !load_markov_wheel(session_configuration.markov_file_path, user_choice_container, user_transition_model)) {
+        return 1;
+    }
     
     // Implement wheel simulation algorithm with statistical randomization
-    execute_wheel_simulation(user_choice_container);
+    if (session_configuration.interactive_session) {
+        execute_interactive_session(user_choice_container, user_weight_container, user_tag_container, session_configuration);
+    } else {
+        execute_wheel_simulation(user_choice_container, user_weight_container, user_transition_model, session_configuration);
+    }
     
     // Terminate program execution with professional completion indicators
     display_program_conclusion();
@@ -49,6 +738,210 @@ int main() {
     return 0; // Standard successful program termination code
 }
 
+/*
+ * Command-line parsing function implementing optional session parameters
+ * Supported switches: --seed <value>, --spin <number>, --audit-spin <number>, --aggregate <spins>, --session,
+ * --benchmark, --prefill-ring <words>, --load-test <requests>, --load-threads <count>,
+ * --load-rate <per second>, --load-options <count>, --load-mix <spins,spins,...>, --secure,
+ * --options-file <path>, --assign-keys <input path>, --assign-output <output path>, --cooldown <spins>,
+ * --fair-rotation, --markov-file <path>, --markov-chains <count>, --markov-steps <count>, --shuffle,
+ * --weighted-shuffle, --physics, --physics-batch <spins>, --record <path>, --record-clips <count>,
+ * --render <path>, --render-images <count>
+ */
+bool parse_command_line_options(int argument_count, char* argument_values[], wheel_session_configuration& session_configuration) {
+    for (int argument_index = 1; argument_index < argument_count; argument_index++) {
+        string current_argument = argument_values[argument_index];
+        
+        // Flag switches take no parameter
+        if (current_argument == "--session") {
+            session_configuration.interactive_session = true;
+            continue;
+        }
+        if (current_argument == "--benchmark") {
+            session_configuration.benchmark_suite = true;
+            continue;
+        }
+        if (current_argument == "--secure") {
+            session_configuration.secure_mode = true;
+            continue;
+        }
+        if (current_argument == "--fair-rotation") {
+            session_configuration.fair_rotation = true;
+            continue;
+        }
+        if (current_argument == "--shuffle") {
+            session_configuration.full_shuffle = true;
+            continue;
+        }
+        if (current_argument == "--weighted-shuffle") {
+            session_configuration.weighted_shuffle = true;
+            continue;
+        }
+        if (current_argument == "--physics") {
+            session_configuration.physics_mode = true;
+            continue;
+        }
+        
+        // Every remaining switch expects exactly one parameter
+        if (argument_index + 1 >= argument_count) {
+            cout << "ERROR: Missing value for command-line option " << current_argument << endl;
+            return false;
+        }
+        
+        // Path switches keep their parameter as text
+        if (current_argument == "--options-file" || current_argument == "--assign-keys" || current_argument == "--assign-output" ||
+            current_argument == "--markov-file" || current_argument == "--record" || current_argument == "--render") {
+            string path_value = argument_values[++argument_index];
+            if (current_argument == "--options-file") {
+                session_configuration.options_file_path = path_value;
+            } else if (current_argument == "--markov-file") {
+                session_configuration.markov_file_path = path_value;
+            } else if (current_argument == "--record") {
+                session_configuration.recording_path = path_value;
+            } else if (current_argument == "--render") {
+                session_configuration.render_path = path_value;
+            } else if (current_argument == "--assign-keys") {
+                session_configuration.key_input_path = path_value;
+            } else {
+                session_configuration.key_output_path = path_value;
+            }
+            continue;
+        }
+        
+        // Spin mixes are comma-separated lists of per-request spin counts
+        if (current_argument == "--load-mix") {
+            istringstream mix_stream(argument_values[++argument_index]);
+            string mix_entry;
+            session_configuration.load_spin_mix.clear();
+            while (getline(mix_stream, mix_entry, ',')) {
+                uint64_t spins_per_request = strtoull(mix_entry.c_str(), nullptr, 0);
+                if (spins_per_request == 0) {
+                    cout << "ERROR: --load-mix entries must be positive spin counts" << endl;
+                    return false;
+                }
+                session_configuration.load_spin_mix.push_back(spins_per_request);
+            }
+            if (session_configuration.load_spin_mix.empty()) {
+                cout << "ERROR: --load-mix requires at least one spin count" << endl;
+                return false;
+            }
+            continue;
+        }
+        uint64_t parameter_value = strtoull(argument_values[++argument_index], nullptr, 0);
+        
+        if (current_argument == "--seed") {
+            session_configuration.counter_based_mode = true;
+            session_configuration.session_seed = parameter_value;
+        } else if (current_argument == "--spin") {
+            session_configuration.spin_number = parameter_value;
+        } else if (current_argument == "--audit-spin") {
+            session_configuration.audit_only = true;
+            session_configuration.spin_number = parameter_value;
+        } else if (current_argument == "--aggregate") {
+            session_configuration.aggregate_spin_count = parameter_value;
+        } else if (current_argument == "--prefill-ring") {
+            session_configuration.prefill_ring_size = static_cast<size_t>(parameter_value);
+        } else if (current_argument == "--load-test") {
+            session_configuration.load_request_count = parameter_value;
+        } else if (current_argument == "--load-threads") {
+            session_configuration.load_thread_count = max<size_t>(1, static_cast<size_t>(parameter_value));
+        } else if (current_argument == "--load-rate") {
+            session_configuration.load_request_rate = parameter_value;
+        } else if (current_argument == "--cooldown") {
+            session_configuration.cooldown_length = static_cast<size_t>(parameter_value);
+        } else if (current_argument == "--physics-batch") {
+            session_configuration.physics_batch_count = parameter_value;
+        } else if (current_argument == "--record-clips") {
+            session_configuration.recording_clip_count = parameter_value;
+        } else if (current_argument == "--render-images") {
+            session_configuration.render_image_count = parameter_value;
+        } else if (current_argument == "--markov-chains") {
+            session_configuration.markov_chain_count = max<size_t>(1, static_cast<size_t>(parameter_value));
+        } else if (current_argument == "--markov-steps") {
+            session_configuration.markov_step_count = max<uint64_t>(1, parameter_value);
+        } else if (current_argument == "--load-options") {
+            session_configuration.load_option_count = max<size_t>(2, static_cast<size_t>(parameter_value));
+        } else {
+            cout << "ERROR: Unrecognized command-line option " << current_argument << endl;
+            return false;
+        }
+    }
+    
+    // Audits are only meaningful against a known session seed
+    if (session_configuration.audit_only && !session_configuration.counter_based_mode) {
+        cout << "ERROR: --audit-spin requires --seed to identify the session" << endl;
+        return false;
+    }
+    
+    // Cooldown and fair rotation make a spin depend on its predecessors, so it cannot be audited in isolation
+    if (session_configuration.audit_only && (session_configuration.cooldown_length > 0 || session_configuration.fair_rotation)) {
+        cout << "ERROR: --audit-spin cannot be combined with --cooldown or --fair-rotation" << endl;
+        return false;
+    }
+    
+    // Transition draws replace the other sequential modes and are not a pure function of one spin
+    if (!session_configuration.markov_file_path.empty() &&
+        (session_configuration.interactive_session || session_configuration.cooldown_length > 0 ||
+         session_configuration.fair_rotation || session_configuration.audit_only)) {
+        cout << "ERROR: --markov-file cannot be combined with --session, --cooldown, --fair-rotation or --audit-spin" << endl;
+        return false;
+    }
+    
+    // The physical spin decides every phase itself, so other sequential models cannot apply
+    if (session_configuration.physics_mode &&
+        (session_configuration.interactive_session || session_configuration.cooldown_length > 0 ||
+         session_configuration.fair_rotation || !session_configuration.markov_file_path.empty())) {
+        cout << "ERROR: --physics cannot be combined with --session, --cooldown, --fair-rotation or --markov-file" << endl;
+        return false;
+    }
+    
+    // Recordings and images capture the simulated rotation, which interactive sessions never run
+    if ((!session_configuration.recording_path.empty() || !session_configuration.render_path.empty()) &&
+        session_configuration.interactive_session) {
+        cout << "ERROR: --record and --render cannot be combined with --session" << endl;
+        return false;
+    }
+    
+    // Batch images follow the same rules as replay clips
+    if (session_configuration.render_image_count > 0) {
+        if (session_configuration.render_path.empty() || !session_configuration.counter_based_mode) {
+            cout << "ERROR: --render-images requires --render <directory> and --seed" << endl;
+            return false;
+        }
+        if (session_configuration.cooldown_length > 0 || session_configuration.fair_rotation ||
+            !session_configuration.markov_file_path.empty()) {
+            cout << "ERROR: --render-images cannot be combined with --cooldown, --fair-rotation or --markov-file" << endl;
+            return false;
+        }
+    }
+    
+    // Replay clips are pure functions of (seed, wheel, spin), so stateful draw models are excluded
+    if (session_configuration.recording_clip_count > 0) {
+        if (session_configuration.recording_path.empty() || !session_configuration.counter_based_mode) {
+            cout << "ERROR: --record-clips requires --record <directory> and --seed" << endl;
+            return false;
+        }
+        if (session_configuration.cooldown_length > 0 || session_configuration.fair_rotation ||
+            !session_configuration.markov_file_path.empty()) {
+            cout << "ERROR: --record-clips cannot be combined with --cooldown, --fair-rotation or --markov-file" << endl;
+            return false;
+        }
+    }
+    
+    // Bulk assignment needs both ends of the pipeline
+    if (session_configuration.key_input_path.empty() != session_configuration.key_output_path.empty()) {
+        cout << "ERROR: --assign-keys and --assign-output must be given together" << endl;
+        return false;
+    }
+    
+    // Secure draws must not be reproducible from a caller-supplied seed
+    if (session_configuration.secure_mode && session_configuration.counter_based_mode) {
+        cout << "ERROR: --secure cannot be combined with --seed" << endl;
+        return false;
+    }
+    return true;
+}
+
 /*
  * Header display function implementing professional program presentation
  * This function establishes the technical context and operational parameters
@@ -59,7 +952,6 @@ void display_program_header() {
     cout << "========================================" << endl;
     cout << "Technical Implementation: Pseudo-Random Selection Algorithm" << endl;
     cout << "Processing Mode: Interactive Decision Support System" << endl;
-    cout << "Statistical Method: Uniform Distribution Randomization" << endl;
     cout << "========================================" << endl << endl;
 }
 
@@ -76,14 +968,14 @@ void collect_user_choices(vector<string>& choice_container) {
     
     // Implement input validation for choice quantity parameters
     do {
-        cout << "Enter total number of decision options (minimum: 2, maximum: 10): ";
+        cout << "Enter total number of decision options (minimum: 2, maximum: " << SMALL_WHEEL_CAPACITY << "): ";
         cin >> total_choice_count;
         
         // Boundary validation implementation for operational parameters
-        if (total_choice_count < 2 || total_choice_count > 10) {
-            cout << "ERROR: Invalid parameter range. Please specify between 2-10 options." << endl;
+        if (total_choice_count < 2 || total_choice_count > static_cast<int>(SMALL_WHEEL_CAPACITY)) {
+            cout << "ERROR: Invalid parameter range. Please specify between 2-" << SMALL_WHEEL_CAPACITY << " options." << endl;
         }
-    } while (total_choice_count < 2 || total_choice_count > 10);
+    } while (total_choice_count < 2 || total_choice_count > static_cast<int>(SMALL_WHEEL_CAPACITY));
     
     // Clear input buffer to prevent stream contamination
     cin.ignore();
@@ -110,108 +1002,760 @@ void collect_user_choices(vector<string>& choice_container) {
 }
 
 /*
- * Wheel simulation function implementing randomization algorithm execution
- * This function processes the statistical selection mechanism with visual feedback
+ * Option file loading function implementing non-interactive choice collection
+ * Each non-empty line holds a label, optionally followed by a tab and a weight,
+ * and optionally by another tab and comma-separated tags
  */
-void execute_wheel_simulation(const vector<string>& choice_container) {
-    cout << "PHASE 2: WHEEL SIMULATION EXECUTION" << endl;
-    cout << "-----------------------------------" << endl;
+bool load_options_file(const string& file_path, vector<string>& choice_container, vector<double>& option_weights, vector<vector<string>>& option_tags) {
+    ifstream options_stream(file_path);
+    if (!options_stream) {
+        cout << "ERROR: Unable to open options file " << file_path << endl;
+        return false;
+    }
     
-    // Initialize random number generator with time-based seed implementation
-    auto current_timestamp = chrono::high_resolution_clock::now();
-    auto seed_value = current_timestamp.time_since_epoch().count();
-    mt19937 random_generator(seed_value);
+    string option_line;
+    while (getline(options_stream, option_line)) {
+        if (!option_line.empty() && option_line.back() == '\r') {
+            option_line.pop_back();
+        }
+        if (option_line.empty()) {
+            continue;
+        }
+        
+        double option_weight = 1.0;
+        vector<string> line_tags;
+        size_t separator_position = option_line.find('\t');
+        if (separator_position != string::npos) {
+            size_t tag_separator_position = option_line.find('\t', separator_position + 1);
+            if (tag_separator_position != string::npos) {
+                istringstream tag_stream(option_line.substr(tag_separator_position + 1));
+                string tag_name;
+                while (getline(tag_stream, tag_name, ',')) {
+                    if (!tag_name.empty()) {
+                        line_tags.push_back(tag_name);
+                    }
+                }
+            }
+            option_weight = strtod(option_line.c_str() + separator_position + 1, nullptr);
+            option_line.resize(separator_position);
+        }
+        if (option_line.empty() || option_weight < 0.0) {
+            cout << "ERROR: Invalid option entry in " << file_path << ": " << option_line << endl;
+            return false;
+        }
+        choice_container.push_back(option_line);
+        option_weights.push_back(option_weight);
+        option_tags.push_back(line_tags);
+    }
     
-    // Configure uniform distribution parameters for index selection
-    uniform_int_distribution<int> distribution_range(0, choice_container.size() - 1);
+    if (choice_container.size() < 2) {
+        cout << "ERROR: Options file must contain at least 2 options." << endl;
+        return false;
+    }
     
-    cout << "Initializing randomization algorithms..." << endl;
-    cout << "Executing wheel rotation simulation..." << endl << endl;
+    // Every weighted path divides by the total, so at least one option must be selectable
+    if (accumulate(option_weights.begin(), option_weights.end(), 0.0) <= 0.0) {
+        cout << "ERROR: Options file weights must include at least one positive weight." << endl;
+        return false;
+    }
+    cout << "Options Loaded From File: " << choice_container.size() << endl << endl;
+    return true;
+}
+
+/*
+ * Wheel identification function implementing FNV-1a hashing of the option set
+ * Identical option lists produce identical identifiers on every replica
+ */
+uint64_t compute_wheel_identifier(const vector<string>& choice_container) {
+    uint64_t hash_state = 14695981039346656037ULL;
     
-    // Visual simulation loop implementing progressive selection feedback
-    for (int simulation_iteration = 1; simulation_iteration <= 5; simulation_iteration++) {
-        cout << "Rotation Phase " << simulation_iteration << ": ";
-        
-        // Generate intermediate random selections for simulation realism
-        int intermediate_selection = distribution_range(random_generator);
-        cout << choice_container[intermediate_selection];
+    for (const string& choice_text : choice_container) {
+        // Hash option text followed by a separator so ["ab"] and ["a", "b"] differ
+        for (unsigned char character_value : choice_text) {
+            hash_state = (hash_state ^ character_value) * 1099511628211ULL;
+        }
+        hash_state = (hash_state ^ 0xFFu) * 1099511628211ULL;
+    }
+    return hash_state;
+}
+
+/*
+ * Counter-based generation function implementing the Philox4x32-10 block cipher
+ * The key is the session seed; the counter packs spin number, wheel id and draw lane
+ */
+uint64_t generate_counter_based_word(uint64_t session_seed, uint64_t wheel_identifier, uint64_t spin_number, uint32_t draw_lane) {
+    uint32_t counter_words[4] = {
+        static_cast<uint32_t>(spin_number),
+        static_cast<uint32_t>(spin_number >> 32),
+        static_cast<uint32_t>(wheel_identifier ^ (wheel_identifier >> 32)),
+        draw_lane
+    };
+    uint32_t key_words[2] = {
+        static_cast<uint32_t>(session_seed),
+        static_cast<uint32_t>(session_seed >> 32)
+    };
+    
+    // Ten Philox rounds with the reference multipliers and Weyl key increments
+    for (int round_index = 0; round_index < 10; round_index++) {
+        uint64_t first_product = 0xD2511F53ULL * counter_words[0];
+        uint64_t second_product = 0xCD9E8D57ULL * counter_words[2];
         
-        // Progressive delay implementation for realistic wheel deceleration
-        for (int delay_counter = 0; delay_counter < 100000000; delay_counter++) {
-            // CPU cycle consumption for timing simulation
+        uint32_t next_words[4] = {
+            static_cast<uint32_t>(second_product >> 32) ^ counter_words[1] ^ key_words[0],
+            static_cast<uint32_t>(second_product),
+            static_cast<uint32_t>(first_product >> 32) ^ counter_words[3] ^ key_words[1],
+            static_cast<uint32_t>(first_product)
+        };
+        for (int word_index = 0; word_index < 4; word_index++) {
+            counter_words[word_index] = next_words[word_index];
         }
         
-        cout << " -> ";
+        key_words[0] += 0x9E3779B9u;
+        key_words[1] += 0xBB67AE85u;
     }
     
-    cout << "FINALIZING SELECTION..." << endl << endl;
-    
-    // Execute final random selection algorithm
-    int final_selected_index = distribution_range(random_generator);
-    string final_selected_choice = choice_container[final_selected_index];
+    return (static_cast<uint64_t>(counter_words[1]) << 32) | counter_words[0];
+}
+
+/*
+ * Range reduction function implementing multiply-high index mapping
+ * Bias is bounded by index_range / 2^64, far below any observable level
+ */
+uint64_t map_random_word_to_index(uint64_t random_word, uint64_t index_range) {
+    // Portable 64x64 -> high 64 multiplication through 32-bit partial products
+    uint64_t word_low = random_word & 0xFFFFFFFFULL, word_high = random_word >> 32;
+    uint64_t range_low = index_range & 0xFFFFFFFFULL, range_high = index_range >> 32;
     
-    // Display professional results presentation
-    cout << "========================================" << endl;
-    cout << "           SELECTION RESULTS            " << endl;
-    cout << "========================================" << endl;
-    cout << "SELECTED OPTION: " << final_selected_choice << endl;
-    cout << "Selection Index: " << final_selected_index + 1 << " of " << choice_container.size() << endl;
-    cout << "========================================" << endl << endl;
+    uint64_t low_low = word_low * range_low;
+    uint64_t high_low = word_high * range_low;
+    uint64_t low_high = word_low * range_high;
+    uint64_t high_high = word_high * range_high;
     
-    // Execute visual representation and statistical analysis
-    display_visual_wheel_representation(choice_container, final_selected_index);
-    display_statistical_analysis(choice_container, final_selected_choice);
+    uint64_t middle_sum = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + (low_high & 0xFFFFFFFFULL);
+    return high_high + (high_low >> 32) + (low_high >> 32) + (middle_sum >> 32);
 }
 
 /*
- * Visual representation function implementing ASCII-based wheel display
- * This function creates a graphical representation of the selection process
+ * Random-access spin function returning the selected index of spin k in O(1)
+ * No generator state is shared, so spins can be evaluated in any order or in parallel
  */
-void display_visual_wheel_representation(const vector<string>& choice_container, int selected_index) {
-    cout << "PHASE 3: VISUAL WHEEL REPRESENTATION" << endl;
-    cout << "------------------------------------" << endl;
-    
-    // Calculate sector angle distribution for visual representation
-    double sector_angle = 360.0 / choice_container.size();
+size_t compute_counter_based_spin(uint64_t session_seed, uint64_t wheel_identifier, uint64_t spin_number, size_t option_count) {
+    uint64_t random_word = generate_counter_based_word(session_seed, wheel_identifier, spin_number, FINAL_SELECTION_LANE);
+    return static_cast<size_t>(map_random_word_to_index(random_word, option_count));
+}
+
+/*
+ * Draw model function implementing one weight-aware selection rule per wheel
+ * Equal or missing weights keep the uniform word mapping, so seeded spins of plain wheels
+ * are unchanged; unequal weights from an options file select through compiled prefix sums.
+ * The reported probabilities follow the final pick: Markov spins propagate the first draw
+ * through the five transitions that precede it
+ */
+void build_effective_draw_model(effective_draw_model& draw_model, const vector<string>& choice_container, const vector<double>& option_weights,
+                                const markov_wheel* transition_model, const wheel_session_configuration& session_configuration) {
+    size_t option_count = choice_container.size();
+    draw_model.weighted_draw = false;
+    for (size_t option_index = 1; option_index < option_weights.size(); option_index++) {
+        if (option_weights[option_index] != option_weights[0]) {
+            draw_model.weighted_draw = true;
+            break;
+        }
+    }
     
-    cout << "Wheel Configuration Analysis:" << endl;
-    cout << "Total Sectors: " << choice_container.size() << endl;
-    cout << "Sector Angle: " << fixed << setprecision(2) << sector_angle << " degrees" << endl;
-    cout << "Selection Probability: " << (100.0 / choice_container.size()) << "% per option" << endl << endl;
+    draw_model.option_probabilities.assign(option_count, 1.0 / option_count);
+    if (draw_model.weighted_draw) {
+        double total_weight = accumulate(option_weights.begin(), option_weights.end(), 0.0);
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            draw_model.option_probabilities[option_index] = option_weights[option_index] / total_weight;
+        }
+        draw_model.draw_wheel.choice_container = choice_container;
+        draw_model.draw_wheel.option_weights = option_weights;
+        compile_wheel(draw_model.draw_wheel);
+    }
     
-    cout << "ASCII Wheel Representation:" << endl;
-    cout << "+--------------------------+" << endl;
+    bool uses_transitions = transition_model != nullptr && !transition_model->row_offsets.empty();
+    if (uses_transitions) {
+        vector<double> next_probabilities(option_count);
+        for (int transition_step = 0; transition_step < 5; transition_step++) {
+            // Options without outgoing transitions jump uniformly, as step_markov_wheel does
+            double uniform_mass = 0.0;
+            fill(next_probabilities.begin(), next_probabilities.end(), 0.0);
+            for (size_t option_index = 0; option_index < option_count; option_index++) {
+                uint64_t row_start = transition_model->row_offsets[option_index];
+                uint64_t row_end = transition_model->row_offsets[option_index + 1];
+                if (row_start == row_end) {
+                    uniform_mass += draw_model.option_probabilities[option_index];
+                }
+                for (uint64_t entry_index = row_start; entry_index < row_end; entry_index++) {
+                    next_probabilities[transition_model->column_indices[entry_index]] +=
+                        draw_model.option_probabilities[option_index] * transition_model->transition_probabilities[entry_index];
+                }
+            }
+            for (size_t option_index = 0; option_index < option_count; option_index++) {
+                draw_model.option_probabilities[option_index] = next_probabilities[option_index] + uniform_mass / option_count;
+            }
+        }
+    }
     
-    // Generate visual wheel sectors with selection highlighting
-    for (size_t wheel_index = 0; wheel_index < choice_container.size(); wheel_index++) {
-        string selection_indicator = (wheel_index == selected_index) ? " <-- SELECTED" : "";
-        cout << "| " << setw(2) << (wheel_index + 1) << ". " 
-             << left << setw(15) << choice_container[wheel_index] << " |" << selection_indicator << endl;
+    draw_model.uniform_outcome = true;
+    for (double option_probability : draw_model.option_probabilities) {
+        draw_model.uniform_outcome = draw_model.uniform_outcome && fabs(option_probability * option_count - 1.0) < 1e-9;
     }
     
-    cout << "+--------------------------+" << endl << endl;
+    // Report name of the model that actually decides the final pick
+    if (session_configuration.physics_mode) {
+        draw_model.model_label = "Physical spin (integer fixed-step integrator, sector angles follow the weights)";
+    } else if (uses_transitions) {
+        draw_model.model_label = "Markov chain (final pick after five transitions from the first draw)";
+    } else if (session_configuration.fair_rotation) {
+        draw_model.model_label = "Fair rotation (stride scheduling; probabilities are long-run pick shares)";
+    } else if (session_configuration.cooldown_length > 0) {
+        draw_model.model_label = "Cooldown draw (probabilities before recent winners are excluded)";
+    } else if (draw_model.weighted_draw) {
+        draw_model.model_label = "Weighted draw (options file weights)";
+    } else {
+        draw_model.model_label = "Uniform draw";
+    }
 }
 
 /*
- * Statistical analysis function implementing mathematical probability calculations
- * This function provides comprehensive statistical interpretation of the selection process
+ * Draw model selection function mapping one random word to an option index
  */
-void display_statistical_analysis(const vector<string>& choice_container, const string& selected_choice) {
-    cout << "PHASE 4: STATISTICAL ANALYSIS REPORT" << endl;
-    cout << "------------------------------------" << endl;
-    
-    // Calculate fundamental probability metrics
-    double individual_probability = 100.0 / choice_container.size();
-    double cumulative_probability = 100.0;
+size_t select_effective_draw_index(const effective_draw_model& draw_model, uint64_t random_word) {
+    if (draw_model.weighted_draw) {
+        return select_compiled_wheel_index(draw_model.draw_wheel, random_word);
+    }
+    return static_cast<size_t>(map_random_word_to_index(random_word, draw_model.option_probabilities.size()));
+}
+
+/*
+ * Audit function implementing direct spot-checks of arbitrary spin numbers
+ * This function recomputes a recorded outcome without replaying earlier spins
+ */
+void execute_counter_based_audit(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration) {
+    uint64_t wheel_identifier = compute_wheel_identifier(choice_container);
+    effective_draw_model draw_model;
+    build_effective_draw_model(draw_model, choice_container, option_weights, nullptr, session_configuration);
+    size_t audited_index = select_effective_draw_index(draw_model, generate_counter_based_word(session_configuration.session_seed, wheel_identifier,
+                                                                                               session_configuration.spin_number, FINAL_SELECTION_LANE));
     
-    cout << "Probability Distribution Analysis:" << endl;
-    cout << "- Individual Option Probability: " << fixed << setprecision(2) 
-         << individual_probability << "%" << endl;
-    cout << "- Cumulative Selection Probability: " << cumulative_probability << "%" << endl;
-    cout << "- Statistical Distribution Type: Uniform" << endl;
-    cout << "- Randomization Algorithm: Mersenne Twister MT19937" << endl << endl;
+    // Physical spins are audited through the closed-form stopping angle, without integration
+    if (session_configuration.physics_mode) {
+        physical_wheel spin_wheel;
+        build_physical_wheel(spin_wheel, option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights);
+        physical_spin_state spin_state = launch_physical_spin(generate_counter_based_word(session_configuration.session_seed, wheel_identifier,
+                                                                                         session_configuration.spin_number, FINAL_SELECTION_LANE));
+        audited_index = locate_physical_sector(spin_wheel, compute_stopping_angle(spin_state));
+    }
     
-    cout << "Selection Validation Metrics:" << endl;
+    cout << "========================================" << endl;
+    cout << "         COUNTER-BASED SPIN AUDIT       " << endl;
+    cout << "========================================" << endl;
+    cout << "Session Seed: " << session_configuration.session_seed << endl;
+    cout << "Wheel Identifier: " << hex << wheel_identifier << dec << endl;
+    cout << "Spin Number: " << session_configuration.spin_number << endl;
+    cout << "SELECTED OPTION: " << choice_container[audited_index] << endl;
+    cout << "Selection Index: " << audited_index + 1 << " of " << choice_container.size() << endl;
+    cout << "========================================" << endl << endl;
+}
+
+/*
+ * Fork handler function invalidating every generator inherited by a child process
+ */
+void handle_fork_in_child_process() {
+    fork_generation_counter.fetch_add(1, memory_order_relaxed);
+}
+
+/*
+ * Thread-local generator function implementing lazy, fork-aware seeding
+ * Each thread owns its generator, so spins never contend on a shared lock; the seed mixes
+ * OS entropy, the clock, a unique stream number and the fork generation
+ */
+mt19937_64& acquire_thread_local_generator() {
+    static once_flag fork_handler_registration;
+    call_once(fork_handler_registration, []() {
+#if defined(__unix__) || defined(__APPLE__)
+        pthread_atfork(nullptr, nullptr, handle_fork_in_child_process);
+#endif
+    });
+    
+    thread_local thread_generator_slot generator_slot;
+    uint64_t current_fork_generation = fork_generation_counter.load(memory_order_relaxed);
+    
+    if (!generator_slot.is_seeded || generator_slot.seeded_fork_generation != current_fork_generation) {
+        random_device entropy_source;
+        uint64_t clock_value = static_cast<uint64_t>(chrono::high_resolution_clock::now().time_since_epoch().count());
+        uint64_t stream_number = generator_stream_counter.fetch_add(1, memory_order_relaxed);
+        
+        seed_seq seed_material{entropy_source(), entropy_source(), entropy_source(), entropy_source(),
+                               static_cast<uint32_t>(clock_value), static_cast<uint32_t>(clock_value >> 32),
+                               static_cast<uint32_t>(stream_number), static_cast<uint32_t>(current_fork_generation)};
+        generator_slot.random_generator.seed(seed_material);
+        generator_slot.seeded_fork_generation = current_fork_generation;
+        generator_slot.is_seeded = true;
+    }
+    return generator_slot.random_generator;
+}
+
+/*
+ * Wheel simulation function implementing randomization algorithm execution
+ * This function processes the statistical selection mechanism with visual feedback
+ */
+void execute_wheel_simulation(const vector<string>& choice_container, const vector<double>& option_weights,
+                              const markov_wheel& transition_model, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: WHEEL SIMULATION EXECUTION" << endl;
+    cout << "-----------------------------------" << endl;
+    
+    // Acquire this thread's generator; it is reseeded automatically after fork()
+    mt19937_64& random_generator = acquire_thread_local_generator();
+    
+    // Configure uniform distribution parameters for index selection; weighted wheels use the draw model instead
+    uniform_int_distribution<int> distribution_range(0, choice_container.size() - 1);
+    effective_draw_model draw_model;
+    build_effective_draw_model(draw_model, choice_container, option_weights, &transition_model, session_configuration);
+    
+    // Counter-based sessions derive every draw from (seed, wheel id, spin number, lane)
+    uint64_t wheel_identifier = compute_wheel_identifier(choice_container);
+    
+    // Secure mode replaces the time seed with kernel entropy and ChaCha20 output
+    chacha20_generator secure_generator;
+    if (session_configuration.secure_mode) {
+        seed_chacha20_generator(secure_generator);
+    }
+    
+    // Optional cooldown keeps recent winners off the wheel across phases and the final pick
+    cooldown_sampler cooldown_state;
+    bool cooldown_enabled = session_configuration.cooldown_length > 0;
+    if (cooldown_enabled) {
+        initialize_cooldown_sampler(cooldown_state, option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights,
+                                    session_configuration.cooldown_length);
+    }
+    
+    auto draw_random_word = [&](uint32_t draw_lane) -> uint64_t {
+        if (session_configuration.counter_based_mode) {
+            return generate_counter_based_word(session_configuration.session_seed, wheel_identifier,
+                                               session_configuration.spin_number, draw_lane);
+        }
+        if (session_configuration.secure_mode) {
+            return next_chacha20_word(secure_generator);
+        }
+        return random_generator();
+    };
+    // Fair rotation resumes the weighted schedule at the configured spin number (six picks per spin)
+    fair_rotation_scheduler rotation_scheduler;
+    if (session_configuration.fair_rotation) {
+        initialize_fair_rotation(rotation_scheduler, option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights);
+        advance_fair_rotation(rotation_scheduler, session_configuration.spin_number * 6);
+    }
+    
+    auto draw_option_index = [&](uint32_t draw_lane) -> int {
+        if (session_configuration.fair_rotation) {
+            return static_cast<int>(next_fair_rotation_index(rotation_scheduler));
+        }
+        if (cooldown_enabled) {
+            return static_cast<int>(draw_cooldown_index(cooldown_state, draw_random_word(draw_lane)));
+        }
+        if (!draw_model.weighted_draw && !session_configuration.counter_based_mode && !session_configuration.secure_mode) {
+            return distribution_range(random_generator);
+        }
+        return static_cast<int>(select_effective_draw_index(draw_model, draw_random_word(draw_lane)));
+    };
+    
+    // With a transition model the first phase is a plain draw and every later pick follows the chain
+    bool uses_transitions = !transition_model.row_offsets.empty();
+    int previous_selection = -1;
+    
+    // A physical spin is launched once; phases show the sector under the pointer as it slows
+    physical_wheel spin_wheel;
+    physical_spin_state spin_state;
+    uint64_t spin_duration_steps = 0;
+    if (session_configuration.physics_mode) {
+        build_physical_wheel(spin_wheel, option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights);
+        spin_state = launch_physical_spin(draw_random_word(FINAL_SELECTION_LANE));
+        spin_duration_steps = count_remaining_physical_steps(spin_state);
+    }
+    
+    auto draw_sequence_index = [&](uint32_t draw_lane) -> int {
+        if (session_configuration.physics_mode) {
+            uint64_t target_step = (draw_lane == FINAL_SELECTION_LANE) ? spin_duration_steps
+                                 : spin_duration_steps * (draw_lane - ROTATION_PHASE_LANE_BASE + 1) / 6;
+            while (spin_state.elapsed_steps < target_step && advance_physical_spin(spin_state)) {
+            }
+            return static_cast<int>(locate_physical_sector(spin_wheel, static_cast<uint32_t>(spin_state.wheel_angle)));
+        }
+        if (uses_transitions && previous_selection >= 0) {
+            previous_selection = static_cast<int>(step_markov_wheel(transition_model, previous_selection, draw_random_word(draw_lane)));
+        } else {
+            previous_selection = draw_option_index(draw_lane);
+        }
+        return previous_selection;
+    };
+    
+    cout << "Initializing randomization algorithms..." << endl;
+    if (session_configuration.counter_based_mode) {
+        cout << "Counter-Based Session: seed " << session_configuration.session_seed
+             << ", wheel " << hex << wheel_identifier << dec
+             << ", spin " << session_configuration.spin_number << endl;
+    }
+    if (session_configuration.physics_mode) {
+        cout << "Physical Spin: launch " << fixed << setprecision(2)
+             << static_cast<double>(spin_state.angular_velocity) * PHYSICS_STEPS_PER_SECOND / PHYSICS_ANGLE_UNITS_PER_TURN
+             << " turns/s, rests after " << static_cast<double>(spin_duration_steps) / PHYSICS_STEPS_PER_SECOND << " s" << endl;
+    }
+    if (uses_transitions) {
+        cout << "Markov Wheel: " << transition_model.column_indices.size() << " transitions condition each phase on the previous one" << endl;
+    }
+    cout << "Executing wheel rotation simulation..." << endl << endl;
+    
+    // Recording replaces the real-time delay with synthetic timestamps
+    bool recording_enabled = !session_configuration.recording_path.empty();
+    vector<int> recorded_phase_indices;
+    
+    // Visual simulation loop implementing progressive selection feedback
+    for (int simulation_iteration = 1; simulation_iteration <= 5; simulation_iteration++) {
+        cout << "Rotation Phase " << simulation_iteration << ": ";
+        
+        // Generate intermediate random selections for simulation realism
+        int intermediate_selection = draw_sequence_index(ROTATION_PHASE_LANE_BASE + simulation_iteration - 1);
+        cout << choice_container[intermediate_selection];
+        recorded_phase_indices.push_back(intermediate_selection);
+        
+        // Progressive delay implementation for realistic wheel deceleration
+        for (int delay_counter = 0; !recording_enabled && delay_counter < 100000000; delay_counter++) {
+            // CPU cycle consumption for timing simulation
+        }
+        
+        cout << " -> ";
+    }
+    
+    cout << "FINALIZING SELECTION..." << endl << endl;
+    
+    // Execute final random selection algorithm
+    int final_selected_index = draw_sequence_index(FINAL_SELECTION_LANE);
+    string final_selected_choice = choice_container[final_selected_index];
+    
+    // Display professional results presentation
+    cout << "========================================" << endl;
+    cout << "           SELECTION RESULTS            " << endl;
+    cout << "========================================" << endl;
+    cout << "SELECTED OPTION: " << final_selected_choice << endl;
+    cout << "Selection Index: " << final_selected_index + 1 << " of " << choice_container.size() << endl;
+    cout << "========================================" << endl << endl;
+    
+    // The recorded clip replays the phases above on their synthetic timeline
+    if (recording_enabled) {
+        spin_recording rotation_recording;
+        append_rotation_clip(rotation_recording, choice_container, recorded_phase_indices, final_selected_index, spin_duration_steps);
+        string clip_title = session_configuration.counter_based_mode ? "Decision wheel spin " + to_string(session_configuration.spin_number)
+                                                                     : string("Decision wheel spin");
+        if (save_spin_recording(rotation_recording, session_configuration.recording_path, clip_title)) {
+            cout << "Recording: " << rotation_recording.event_texts.size() << " events, " << fixed << setprecision(2)
+                 << rotation_recording.event_times.back() << " s of animation written to " << session_configuration.recording_path << endl << endl;
+        }
+    }
+    
+    // The published image shows the wheel at rest: physical spins at their resting angle,
+    // other draws with the pointer centred on the winning sector
+    if (!session_configuration.render_path.empty()) {
+        physical_wheel image_wheel = spin_wheel;
+        if (!session_configuration.physics_mode) {
+            build_physical_wheel(image_wheel, draw_model.option_probabilities);
+        }
+        uint32_t pointer_angle = session_configuration.physics_mode ? static_cast<uint32_t>(spin_state.wheel_angle)
+                                                                    : compute_sector_center_angle(image_wheel, final_selected_index);
+        raster_image wheel_image;
+        render_wheel_image(wheel_image, choice_container, image_wheel, pointer_angle, final_selected_index);
+        if (write_raster_image(wheel_image, session_configuration.render_path)) {
+            cout << "Wheel Image: " << wheel_image.image_width << "x" << wheel_image.image_height
+                 << " written to " << session_configuration.render_path << endl << endl;
+        }
+    }
+    
+    // Execute visual representation and statistical analysis
+    display_visual_wheel_representation(choice_container, draw_model, final_selected_index);
+    display_statistical_analysis(choice_container, draw_model, final_selected_index, session_configuration);
+    
+    // Aggregate tallies are reported alongside the single-spin statistics
+    if (session_configuration.aggregate_spin_count > 0) {
+        display_aggregate_tally_analysis(choice_container, draw_model, session_configuration);
+    }
+    
+    // Batch physics checks the physical outcome distribution with and without pegs
+    if (session_configuration.physics_batch_count > 0) {
+        display_physical_batch_analysis(choice_container, option_weights, session_configuration);
+    }
+    
+    // Transition models additionally report their long-run behavior
+    if (uses_transitions) {
+        execute_markov_chain_analysis(choice_container, transition_model, session_configuration);
+    }
+}
+
+/*
+ * Binomial sampling function implementing inversion for small means and BTPE otherwise
+ * Expected cost is O(1) in the trial count (Kachitvichyanukul & Schmeiser, 1988)
+ */
+uint64_t sample_binomial_variate(uint64_t trial_count, double success_probability, mt19937_64& random_generator) {
+    uniform_real_distribution<double> unit_interval(0.0, 1.0);
+    
+    // Degenerate parameters need no random draws
+    if (trial_count == 0 || success_probability <= 0.0) {
+        return 0;
+    }
+    if (success_probability >= 1.0) {
+        return trial_count;
+    }
+    
+    // Sample with the smaller tail probability and mirror the result afterwards
+    double reduced_probability = min(success_probability, 1.0 - success_probability);
+    double failure_probability = 1.0 - reduced_probability;
+    double trial_total = static_cast<double>(trial_count);
+    double mean_value = trial_total * reduced_probability;
+    uint64_t sampled_value = 0;
+    
+    if (mean_value < 30.0) {
+        // Sequential inversion: walk the probability mass function from zero
+        double zero_probability = exp(trial_total * log(failure_probability));
+        double search_bound = min(trial_total, mean_value + 10.0 * sqrt(mean_value * failure_probability + 1.0));
+        double mass_value = zero_probability;
+        double uniform_value = unit_interval(random_generator);
+        
+        while (uniform_value > mass_value) {
+            sampled_value++;
+            if (sampled_value > search_bound) {
+                sampled_value = 0;
+                mass_value = zero_probability;
+                uniform_value = unit_interval(random_generator);
+            } else {
+                uniform_value -= mass_value;
+                mass_value = ((trial_total - sampled_value + 1) * reduced_probability * mass_value)
+                             / (sampled_value * failure_probability);
+            }
+        }
+    } else {
+        // BTPE setup: triangle, parallelogram and exponential tails around the mode
+        double variance_value = mean_value * failure_probability;
+        double mode_fraction = mean_value + reduced_probability;
+        double mode_value = floor(mode_fraction);
+        double triangle_width = floor(2.195 * sqrt(variance_value) - 4.6 * failure_probability) + 0.5;
+        double mode_midpoint = mode_value + 0.5;
+        double left_edge = mode_midpoint - triangle_width;
+        double right_edge = mode_midpoint + triangle_width;
+        double parallelogram_height = 0.134 + 20.5 / (15.3 + mode_value);
+        double left_ratio = (mode_fraction - left_edge) / (mode_fraction - left_edge * reduced_probability);
+        double left_lambda = left_ratio * (1.0 + left_ratio / 2.0);
+        double right_ratio = (right_edge - mode_fraction) / (right_edge * failure_probability);
+        double right_lambda = right_ratio * (1.0 + right_ratio / 2.0);
+        double region_two = triangle_width * (1.0 + 2.0 * parallelogram_height);
+        double region_three = region_two + parallelogram_height / left_lambda;
+        double region_four = region_three + parallelogram_height / right_lambda;
+        
+        while (true) {
+            double uniform_value = unit_interval(random_generator) * region_four;
+            double acceptance_value = unit_interval(random_generator);
+            double candidate_value;
+            
+            if (uniform_value <= triangle_width) {
+                // Triangular region: immediate acceptance
+                sampled_value = static_cast<uint64_t>(floor(mode_midpoint - triangle_width * acceptance_value + uniform_value));
+                break;
+            } else if (uniform_value <= region_two) {
+                // Parallelogram region
+                double position_value = left_edge + (uniform_value - triangle_width) / parallelogram_height;
+                acceptance_value = acceptance_value * parallelogram_height + 1.0
+                                   - fabs(mode_value - position_value + 0.5) / triangle_width;
+                if (acceptance_value > 1.0) {
+                    continue;
+                }
+                candidate_value = floor(position_value);
+            } else if (uniform_value <= region_three) {
+                // Left exponential tail
+                candidate_value = floor(left_edge + log(acceptance_value) / left_lambda);
+                if (candidate_value < 0.0) {
+                    continue;
+                }
+                acceptance_value *= (uniform_value - region_two) * left_lambda;
+            } else {
+                // Right exponential tail
+                candidate_value = floor(right_edge - log(acceptance_value) / right_lambda);
+                if (candidate_value > trial_total) {
+                    continue;
+                }
+                acceptance_value *= (uniform_value - region_three) * right_lambda;
+            }
+            
+            double mode_distance = fabs(candidate_value - mode_value);
+            if (mode_distance <= 20.0 || mode_distance >= variance_value / 2.0 - 1.0) {
+                // Explicit evaluation of the mass ratio f(candidate) / f(mode)
+                double odds_ratio = reduced_probability / failure_probability;
+                double odds_scale = odds_ratio * (trial_total + 1.0);
+                double mass_ratio = 1.0;
+                if (mode_value < candidate_value) {
+                    for (double step_index = mode_value + 1.0; step_index <= candidate_value; step_index += 1.0) {
+                        mass_ratio *= (odds_scale / step_index - odds_ratio);
+                    }
+                } else if (mode_value > candidate_value) {
+                    for (double step_index = candidate_value + 1.0; step_index <= mode_value; step_index += 1.0) {
+                        mass_ratio /= (odds_scale / step_index - odds_ratio);
+                    }
+                }
+                if (acceptance_value > mass_ratio) {
+                    continue;
+                }
+            } else {
+                // Squeeze on log-scale followed by the Stirling-corrected final test
+                double squeeze_rho = (mode_distance / variance_value)
+                    * ((mode_distance * (mode_distance / 3.0 + 0.625) + 0.1666666666666667) / variance_value + 0.5);
+                double squeeze_center = -mode_distance * mode_distance / (2.0 * variance_value);
+                double log_acceptance = log(acceptance_value);
+                
+                if (log_acceptance > squeeze_center + squeeze_rho) {
+                    continue;
+                }
+                if (log_acceptance >= squeeze_center - squeeze_rho) {
+                    double x1 = candidate_value + 1.0, f1 = mode_value + 1.0;
+                    double z1 = trial_total + 1.0 - mode_value, w1 = trial_total - candidate_value + 1.0;
+                    double x2 = x1 * x1, f2 = f1 * f1, z2 = z1 * z1, w2 = w1 * w1;
+                    double log_bound = mode_midpoint * log(f1 / x1)
+                        + (trial_total - mode_value + 0.5) * log(z1 / w1)
+                        + (candidate_value - mode_value) * log(w1 * reduced_probability / (x1 * failure_probability))
+                        + (13680. - (462. - (132. - (99. - 140. / f2) / f2) / f2) / f2) / f1 / 166320.
+                        + (13680. - (462. - (132. - (99. - 140. / z2) / z2) / z2) / z2) / z1 / 166320.
+                        + (13680. - (462. - (132. - (99. - 140. / x2) / x2) / x2) / x2) / x1 / 166320.
+                        + (13680. - (462. - (132. - (99. - 140. / w2) / w2) / w2) / w2) / w1 / 166320.;
+                    if (log_acceptance > log_bound) {
+                        continue;
+                    }
+                }
+            }
+            
+            sampled_value = static_cast<uint64_t>(candidate_value);
+            break;
+        }
+    }
+    
+    return (success_probability > 0.5) ? trial_count - sampled_value : sampled_value;
+}
+
+/*
+ * Multinomial sampling function implementing a chain of conditional binomials
+ * Cost is O(option count) regardless of how many spins are being tallied
+ */
+vector<uint64_t> sample_multinomial_counts(uint64_t total_spin_count, const vector<double>& option_probabilities, mt19937_64& random_generator) {
+    vector<uint64_t> option_counts(option_probabilities.size(), 0);
+    uint64_t remaining_spin_count = total_spin_count;
+    double remaining_probability = 1.0;
+    
+    for (size_t option_index = 0; option_index + 1 < option_probabilities.size() && remaining_spin_count > 0; option_index++) {
+        // Option i wins Binomial(remaining, p_i / remaining mass) of the undecided spins
+        double conditional_probability = (remaining_probability > 0.0)
+            ? min(1.0, option_probabilities[option_index] / remaining_probability) : 1.0;
+        option_counts[option_index] = sample_binomial_variate(remaining_spin_count, conditional_probability, random_generator);
+        remaining_spin_count -= option_counts[option_index];
+        remaining_probability -= option_probabilities[option_index];
+    }
+    
+    // The final option receives every spin not claimed earlier in the chain
+    if (!option_counts.empty()) {
+        option_counts.back() += remaining_spin_count;
+    }
+    return option_counts;
+}
+
+/*
+ * Visual representation function implementing ASCII-based wheel display
+ * This function creates a graphical representation of the selection process.
+ * Sectors are sized by the draw model's outcome probabilities, and the rim strip is drawn
+ * by resolving each cell's centre angle through the wheel's sector lookup table
+ */
+void display_visual_wheel_representation(const vector<string>& choice_container, const effective_draw_model& draw_model, int selected_index) {
+    cout << "PHASE 3: VISUAL WHEEL REPRESENTATION" << endl;
+    cout << "------------------------------------" << endl;
+    
+    // Lay out sector geometry exactly as the physical wheel does (uniform for uniform outcomes)
+    physical_wheel display_wheel;
+    build_physical_wheel(display_wheel, draw_model.option_probabilities);
+    vector<double> sector_degrees(choice_container.size());
+    for (size_t sector_index = 0; sector_index < choice_container.size(); sector_index++) {
+        uint64_t sector_end = (sector_index + 1 < choice_container.size()) ? display_wheel.sector_starts[sector_index + 1] : PHYSICS_ANGLE_UNITS_PER_TURN;
+        sector_degrees[sector_index] = 360.0 * static_cast<double>(sector_end - display_wheel.sector_starts[sector_index]) / PHYSICS_ANGLE_UNITS_PER_TURN;
+    }
+    bool weighted_layout = !draw_model.uniform_outcome;
+    
+    cout << "Wheel Configuration Analysis:" << endl;
+    cout << "Total Sectors: " << choice_container.size() << endl;
+    if (weighted_layout) {
+        cout << "Sector Angles: weighted, " << fixed << setprecision(2) << *min_element(sector_degrees.begin(), sector_degrees.end())
+             << " to " << *max_element(sector_degrees.begin(), sector_degrees.end()) << " degrees" << endl;
+        cout << "Selection Probability: proportional to sector angle ("
+             << 100.0 * draw_model.option_probabilities[selected_index] << "% for the selected option)" << endl << endl;
+    } else {
+        // Calculate sector angle distribution for visual representation
+        double sector_angle = 360.0 / choice_container.size();
+        cout << "Sector Angle: " << fixed << setprecision(2) << sector_angle << " degrees" << endl;
+        cout << "Selection Probability: " << (100.0 / choice_container.size()) << "% per option" << endl << endl;
+    }
+    
+    cout << "ASCII Wheel Representation:" << endl;
+    cout << "+--------------------------+" << endl;
+    
+    // Generate visual wheel sectors with selection highlighting
+    for (size_t wheel_index = 0; wheel_index < choice_container.size(); wheel_index++) {
+        string selection_indicator = (static_cast<int>(wheel_index) == selected_index) ? " <-- SELECTED" : "";
+        string angle_indicator = weighted_layout ? " " + to_string(static_cast<int>(sector_degrees[wheel_index] + 0.5)) + " deg" : "";
+        cout << "| " << setw(2) << (wheel_index + 1) << ". " 
+             << left << setw(15) << choice_container[wheel_index] << " |" << angle_indicator << selection_indicator << endl;
+    }
+    
+    cout << "+--------------------------+" << endl;
+    
+    // Rim strip: alternating fills mark sector boundaries, '#' marks the selected sector
+    const int rim_cell_count = 48;
+    string rim_strip;
+    for (int rim_cell = 0; rim_cell < rim_cell_count; rim_cell++) {
+        uint32_t cell_angle = static_cast<uint32_t>((2 * rim_cell + 1) * (PHYSICS_ANGLE_UNITS_PER_TURN / (2 * rim_cell_count)));
+        size_t cell_sector = locate_physical_sector(display_wheel, cell_angle);
+        rim_strip += (static_cast<int>(cell_sector) == selected_index) ? '#' : ((cell_sector % 2 == 0) ? '-' : '=');
+    }
+    cout << "Wheel Rim (0-360 deg): [" << rim_strip << "]" << endl << endl;
+}
+
+/*
+ * Statistical analysis function implementing mathematical probability calculations
+ * This function provides comprehensive statistical interpretation of the selection process
+ */
+void display_statistical_analysis(const vector<string>& choice_container, const effective_draw_model& draw_model, int selected_index,
+                                  const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 4: STATISTICAL ANALYSIS REPORT" << endl;
+    cout << "------------------------------------" << endl;
+    
+    // Calculate fundamental probability metrics from the model that decided the spin
+    const string& selected_choice = choice_container[selected_index];
+    double cumulative_probability = 100.0;
+    
+    cout << "Probability Distribution Analysis:" << endl;
+    if (draw_model.uniform_outcome) {
+        cout << "- Individual Option Probability: " << fixed << setprecision(2)
+             << 100.0 / choice_container.size() << "%" << endl;
+    } else {
+        cout << "- Selected Option Probability: " << fixed << setprecision(2)
+             << 100.0 * draw_model.option_probabilities[selected_index] << "%" << endl;
+        cout << "- Option Probability Range: "
+             << 100.0 * *min_element(draw_model.option_probabilities.begin(), draw_model.option_probabilities.end()) << "% to "
+             << 100.0 * *max_element(draw_model.option_probabilities.begin(), draw_model.option_probabilities.end()) << "%" << endl;
+    }
+    cout << "- Cumulative Selection Probability: " << cumulative_probability << "%" << endl;
+    cout << "- Statistical Distribution Type: " << (draw_model.uniform_outcome ? "Uniform" : "Weighted") << endl;
+    cout << "- Outcome Model: " << draw_model.model_label << endl;
+    if (session_configuration.secure_mode) {
+        cout << "- Randomization Algorithm: ChaCha20 (kernel-seeded CSPRNG)" << endl << endl;
+    } else if (session_configuration.counter_based_mode) {
+        cout << "- Randomization Algorithm: Philox4x32-10 (counter-based, reproducible)" << endl << endl;
+    } else {
+        cout << "- Randomization Algorithm: Mersenne Twister MT19937" << endl << endl;
+    }
+    
+    cout << "Selection Validation Metrics:" << endl;
     cout << "- Selected Option Length: " << selected_choice.length() << " characters" << endl;
     cout << "- Option Set Diversity Index: " << choice_container.size() << " unique choices" << endl;
     cout << "- Decision Complexity Factor: " << (choice_container.size() > 5 ? "High" : "Standard") << endl << endl;
@@ -226,8 +1770,3983 @@ void display_statistical_analysis(const vector<string>& choice_container, const
         cout << "- Decision Complexity: HIGH - Extensive option set may benefit from preliminary filtering" << endl;
     }
     
-    cout << "- Statistical Confidence: 100% (uniform distribution implementation)" << endl;
-    cout << "- Bias Elimination: VERIFIED (cryptographically secure randomization)" << endl << endl;
+    cout << "- Statistical Confidence: 100% (" << (draw_model.uniform_outcome ? "uniform" : "weighted") << " distribution implementation)" << endl;
+    if (session_configuration.secure_mode) {
+        cout << "- Bias Elimination: VERIFIED (cryptographically secure randomization)" << endl << endl;
+    } else {
+        cout << "- Bias Elimination: STATISTICAL ONLY (predictable generator; use --secure for prize draws)" << endl << endl;
+    }
+}
+
+/*
+ * Aggregate tally function implementing spin-loop-free Monte Carlo reporting
+ * This function draws per-option win counts for a large spin total in one pass,
+ * using the same outcome probabilities as the live spin
+ */
+void display_aggregate_tally_analysis(const vector<string>& choice_container, const effective_draw_model& draw_model,
+                                      const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 5: AGGREGATE TALLY ANALYSIS" << endl;
+    cout << "--------------------------------" << endl;
+    
+    // Seeded sessions reproduce their tallies; otherwise draw a seed from the thread generator
+    uint64_t tally_seed = session_configuration.counter_based_mode
+        ? session_configuration.session_seed ^ compute_wheel_identifier(choice_container)
+        : acquire_thread_local_generator()();
+    mt19937_64 random_generator(tally_seed);
+    
+    // The draw model's outcome probabilities feed the conditional binomial chain
+    auto sampling_start = chrono::steady_clock::now();
+    vector<uint64_t> option_counts = sample_multinomial_counts(session_configuration.aggregate_spin_count,
+                                                               draw_model.option_probabilities, random_generator);
+    auto sampling_duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - sampling_start);
+    
+    cout << "Simulated Spin Count: " << session_configuration.aggregate_spin_count << endl;
+    cout << "Sampling Method: Multinomial (conditional binomial chain, BTPE)" << endl;
+    cout << "Outcome Model: " << draw_model.model_label << endl;
+    cout << "Sampling Time: " << sampling_duration.count() << " microseconds" << endl << endl;
+    
+    for (size_t option_index = 0; option_index < choice_container.size(); option_index++) {
+        double observed_share = 100.0 * option_counts[option_index] / session_configuration.aggregate_spin_count;
+        cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15) << choice_container[option_index]
+             << " | " << right << setw(16) << option_counts[option_index]
+             << " wins | " << fixed << setprecision(4) << setw(8) << observed_share << "% |" << endl;
+    }
+    cout << left << endl;
+}
+
+/*
+ * Markov file loading function reading "from<TAB>to<TAB>weight" transition lines
+ * Labels must match loaded options; repeated pairs accumulate their weights
+ */
+bool load_markov_wheel(const string& file_path, const vector<string>& choice_container, markov_wheel& transition_model) {
+    ifstream transition_stream(file_path);
+    if (!transition_stream) {
+        cout << "ERROR: Unable to open Markov transition file " << file_path << endl;
+        return false;
+    }
+    
+    unordered_map<string, uint32_t> option_lookup;
+    for (size_t option_index = 0; option_index < choice_container.size(); option_index++) {
+        option_lookup.emplace(choice_container[option_index], static_cast<uint32_t>(option_index));
+    }
+    
+    vector<vector<pair<uint32_t, double>>> row_entries(choice_container.size());
+    string transition_line;
+    while (getline(transition_stream, transition_line)) {
+        if (!transition_line.empty() && transition_line.back() == '\r') {
+            transition_line.pop_back();
+        }
+        if (transition_line.empty()) {
+            continue;
+        }
+        
+        size_t first_separator = transition_line.find('\t');
+        size_t second_separator = (first_separator == string::npos) ? string::npos : transition_line.find('\t', first_separator + 1);
+        if (second_separator == string::npos) {
+            cout << "ERROR: Transition lines must be 'from<TAB>to<TAB>weight': " << transition_line << endl;
+            return false;
+        }
+        auto source_entry = option_lookup.find(transition_line.substr(0, first_separator));
+        auto target_entry = option_lookup.find(transition_line.substr(first_separator + 1, second_separator - first_separator - 1));
+        double transition_weight = strtod(transition_line.c_str() + second_separator + 1, nullptr);
+        if (source_entry == option_lookup.end() || target_entry == option_lookup.end() || transition_weight < 0.0) {
+            cout << "ERROR: Invalid transition in " << file_path << ": " << transition_line << endl;
+            return false;
+        }
+        row_entries[source_entry->second].emplace_back(target_entry->second, transition_weight);
+    }
+    
+    build_markov_wheel(transition_model, row_entries);
+    cout << "Markov Transitions Loaded: " << transition_model.column_indices.size() << endl << endl;
+    return true;
+}
+
+/*
+ * Markov wheel construction function building CSR rows and per-row alias tables
+ * Vose's method runs once per row, so construction is linear in the non-zero count
+ */
+void build_markov_wheel(markov_wheel& transition_model, vector<vector<pair<uint32_t, double>>>& row_entries) {
+    transition_model.row_offsets.assign(1, 0);
+    transition_model.column_indices.clear();
+    transition_model.transition_probabilities.clear();
+    transition_model.alias_thresholds.clear();
+    transition_model.alias_columns.clear();
+    vector<size_t> small_slots, large_slots;
+    vector<double> scaled_probabilities;
+    
+    for (vector<pair<uint32_t, double>>& row : row_entries) {
+        // Merge repeated destinations and drop zero weights
+        sort(row.begin(), row.end());
+        vector<pair<uint32_t, double>> merged_row;
+        for (const pair<uint32_t, double>& row_entry : row) {
+            if (!merged_row.empty() && merged_row.back().first == row_entry.first) {
+                merged_row.back().second += row_entry.second;
+            } else {
+                merged_row.push_back(row_entry);
+            }
+        }
+        merged_row.erase(remove_if(merged_row.begin(), merged_row.end(),
+                                   [](const pair<uint32_t, double>& row_entry) { return row_entry.second <= 0.0; }),
+                         merged_row.end());
+        
+        double row_total = 0.0;
+        for (const pair<uint32_t, double>& row_entry : merged_row) {
+            row_total += row_entry.second;
+        }
+        size_t row_length = merged_row.size();
+        size_t row_start = transition_model.column_indices.size();
+        
+        // Vose alias table: slots below the mean borrow their remainder from a slot above it
+        scaled_probabilities.assign(row_length, 0.0);
+        small_slots.clear();
+        large_slots.clear();
+        for (size_t slot_index = 0; slot_index < row_length; slot_index++) {
+            transition_model.column_indices.push_back(merged_row[slot_index].first);
+            transition_model.transition_probabilities.push_back(merged_row[slot_index].second / row_total);
+            transition_model.alias_thresholds.push_back(1.0);
+            transition_model.alias_columns.push_back(merged_row[slot_index].first);
+            scaled_probabilities[slot_index] = merged_row[slot_index].second / row_total * row_length;
+            (scaled_probabilities[slot_index] < 1.0 ? small_slots : large_slots).push_back(slot_index);
+        }
+        while (!small_slots.empty() && !large_slots.empty()) {
+            size_t small_slot = small_slots.back();
+            size_t large_slot = large_slots.back();
+            small_slots.pop_back();
+            transition_model.alias_thresholds[row_start + small_slot] = scaled_probabilities[small_slot];
+            transition_model.alias_columns[row_start + small_slot] = merged_row[large_slot].first;
+            scaled_probabilities[large_slot] -= 1.0 - scaled_probabilities[small_slot];
+            if (scaled_probabilities[large_slot] < 1.0) {
+                large_slots.pop_back();
+                small_slots.push_back(large_slot);
+            }
+        }
+        transition_model.row_offsets.push_back(transition_model.column_indices.size());
+    }
+}
+
+/*
+ * Markov step function implementing an O(1) alias draw from the current row
+ * The high part of word * row_length picks the slot; the low part is the coin
+ */
+size_t step_markov_wheel(const markov_wheel& transition_model, size_t current_option, uint64_t random_word) {
+    uint64_t row_start = transition_model.row_offsets[current_option];
+    uint64_t row_length = transition_model.row_offsets[current_option + 1] - row_start;
+    if (row_length == 0) {
+        return static_cast<size_t>(map_random_word_to_index(random_word, transition_model.row_offsets.size() - 1));
+    }
+    
+    uint64_t slot_index = map_random_word_to_index(random_word, row_length);
+    double slot_fraction = static_cast<double>((random_word * row_length) >> 11) * (1.0 / 9007199254740992.0);
+    uint64_t table_position = row_start + slot_index;
+    return (slot_fraction < transition_model.alias_thresholds[table_position])
+        ? transition_model.column_indices[table_position]
+        : transition_model.alias_columns[table_position];
+}
+
+/*
+ * Stationary distribution function implementing lazy power iteration over the CSR matrix
+ * The lazy walk (I + P) / 2 shares P's stationary vector but also converges for periodic chains
+ */
+vector<double> compute_markov_stationary_distribution(const markov_wheel& transition_model, size_t& iteration_count) {
+    size_t option_count = transition_model.row_offsets.size() - 1;
+    vector<double> stationary_vector(option_count, 1.0 / option_count);
+    vector<double> next_vector(option_count);
+    
+    for (iteration_count = 1; iteration_count <= 100000; iteration_count++) {
+        double uniform_mass = 0.0;
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            next_vector[option_index] = 0.5 * stationary_vector[option_index];
+        }
+        for (size_t row_index = 0; row_index < option_count; row_index++) {
+            double row_mass = 0.5 * stationary_vector[row_index];
+            if (transition_model.row_offsets[row_index] == transition_model.row_offsets[row_index + 1]) {
+                uniform_mass += row_mass;
+                continue;
+            }
+            for (uint64_t entry_index = transition_model.row_offsets[row_index]; entry_index < transition_model.row_offsets[row_index + 1]; entry_index++) {
+                next_vector[transition_model.column_indices[entry_index]] += row_mass * transition_model.transition_probabilities[entry_index];
+            }
+        }
+        
+        double change_norm = 0.0;
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            next_vector[option_index] += uniform_mass / option_count;
+            change_norm += fabs(next_vector[option_index] - stationary_vector[option_index]);
+        }
+        stationary_vector.swap(next_vector);
+        if (change_norm < 1e-13) {
+            break;
+        }
+    }
+    return stationary_vector;
+}
+
+/*
+ * Markov analysis function implementing a batched, multi-threaded chain simulator
+ * Every chain starts at the first option and draws step s of chain c from the counter
+ * stream, so results do not depend on the thread count. The ensemble distribution at
+ * power-of-two checkpoints measures mixing; late-step occupancy estimates the stationary law
+ */
+void execute_markov_chain_analysis(const vector<string>& choice_container, const markov_wheel& transition_model, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 6: MARKOV CHAIN ANALYSIS" << endl;
+    cout << "------------------------------" << endl;
+    
+    size_t option_count = choice_container.size();
+    size_t chain_count = session_configuration.markov_chain_count;
+    uint64_t step_count = session_configuration.markov_step_count;
+    uint64_t burn_in_steps = step_count / 2;
+    uint64_t chain_seed = session_configuration.counter_based_mode ? session_configuration.session_seed : acquire_thread_local_generator()();
+    uint64_t stream_identifier = compute_wheel_identifier(choice_container) ^ MARKOV_CHAIN_STREAM;
+    
+    vector<uint64_t> checkpoint_steps;
+    for (uint64_t checkpoint_step = 1; checkpoint_step < step_count; checkpoint_step *= 2) {
+        checkpoint_steps.push_back(checkpoint_step);
+    }
+    checkpoint_steps.push_back(step_count);
+    
+    // Workers own disjoint chain ranges and private tallies that are merged afterwards
+    size_t worker_count = min<size_t>(max(1u, thread::hardware_concurrency()), (chain_count + MARKOV_CHAIN_BATCH - 1) / MARKOV_CHAIN_BATCH);
+    vector<vector<uint64_t>> worker_occupancy(worker_count, vector<uint64_t>(option_count, 0));
+    vector<vector<uint64_t>> worker_checkpoints(worker_count, vector<uint64_t>(checkpoint_steps.size() * option_count, 0));
+    auto simulation_start = chrono::steady_clock::now();
+    
+    auto simulate_chain_range = [&](size_t worker_index, size_t first_chain, size_t last_chain) {
+        vector<uint64_t>& occupancy_counts = worker_occupancy[worker_index];
+        vector<uint64_t>& checkpoint_counts = worker_checkpoints[worker_index];
+        size_t chain_states[MARKOV_CHAIN_BATCH];
+        
+        for (size_t batch_start = first_chain; batch_start < last_chain; batch_start += MARKOV_CHAIN_BATCH) {
+            size_t batch_length = min(MARKOV_CHAIN_BATCH, last_chain - batch_start);
+            fill(chain_states, chain_states + batch_length, 0);
+            size_t checkpoint_position = 0;
+            
+            // Lock-step batch: independent rows are fetched for every chain before the next step
+            for (uint64_t step_index = 1; step_index <= step_count; step_index++) {
+                for (size_t lane_index = 0; lane_index < batch_length; lane_index++) {
+                    uint64_t random_word = generate_counter_based_word(chain_seed, stream_identifier, step_index,
+                                                                       static_cast<uint32_t>(batch_start + lane_index));
+                    chain_states[lane_index] = step_markov_wheel(transition_model, chain_states[lane_index], random_word);
+                }
+                if (step_index > burn_in_steps) {
+                    for (size_t lane_index = 0; lane_index < batch_length; lane_index++) {
+                        occupancy_counts[chain_states[lane_index]]++;
+                    }
+                }
+                if (step_index == checkpoint_steps[checkpoint_position]) {
+                    for (size_t lane_index = 0; lane_index < batch_length; lane_index++) {
+                        checkpoint_counts[checkpoint_position * option_count + chain_states[lane_index]]++;
+                    }
+                    checkpoint_position++;
+                }
+            }
+        }
+    };
+    
+    vector<thread> chain_workers;
+    size_t batch_total = (chain_count + MARKOV_CHAIN_BATCH - 1) / MARKOV_CHAIN_BATCH;
+    for (size_t worker_index = 0; worker_index < worker_count; worker_index++) {
+        size_t first_chain = min(chain_count, batch_total * worker_index / worker_count * MARKOV_CHAIN_BATCH);
+        size_t last_chain = min(chain_count, batch_total * (worker_index + 1) / worker_count * MARKOV_CHAIN_BATCH);
+        chain_workers.emplace_back(simulate_chain_range, worker_index, first_chain, last_chain);
+    }
+    for (thread& chain_worker : chain_workers) {
+        chain_worker.join();
+    }
+    double simulation_seconds = chrono::duration<double>(chrono::steady_clock::now() - simulation_start).count();
+    
+    for (size_t worker_index = 1; worker_index < worker_count; worker_index++) {
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            worker_occupancy[0][option_index] += worker_occupancy[worker_index][option_index];
+        }
+        for (size_t count_index = 0; count_index < worker_checkpoints[0].size(); count_index++) {
+            worker_checkpoints[0][count_index] += worker_checkpoints[worker_index][count_index];
+        }
+    }
+    
+    size_t iteration_count = 0;
+    vector<double> stationary_vector = compute_markov_stationary_distribution(transition_model, iteration_count);
+    
+    cout << "Chains: " << chain_count << " x " << step_count << " steps from option 1 ("
+         << worker_count << " threads, " << fixed << setprecision(1)
+         << chain_count * static_cast<double>(step_count) / simulation_seconds / 1e6 << " M steps/s)" << endl;
+    cout << "Stationary Distribution: lazy power iteration, " << iteration_count << " iterations" << endl << endl;
+    
+    // Occupancy after burn-in against the exact stationary vector
+    double occupancy_total = static_cast<double>(chain_count) * (step_count - burn_in_steps);
+    double occupancy_distance = 0.0;
+    for (size_t option_index = 0; option_index < option_count; option_index++) {
+        occupancy_distance += fabs(worker_occupancy[0][option_index] / occupancy_total - stationary_vector[option_index]);
+    }
+    size_t displayed_options = min<size_t>(option_count, 20);
+    for (size_t option_index = 0; option_index < displayed_options; option_index++) {
+        cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15) << choice_container[option_index]
+             << " | stationary " << right << fixed << setprecision(4) << setw(8) << 100.0 * stationary_vector[option_index]
+             << "% | simulated " << setw(8) << 100.0 * worker_occupancy[0][option_index] / occupancy_total << "% |" << endl;
+    }
+    if (displayed_options < option_count) {
+        cout << "| ... " << option_count - displayed_options << " more options" << endl;
+    }
+    cout << left << endl;
+    
+    // Total-variation distance of the ensemble from the stationary law; 0.25 defines the mixing time
+    double noise_floor = 0.0;
+    for (size_t option_index = 0; option_index < option_count; option_index++) {
+        noise_floor += 0.5 * sqrt(2.0 / acos(-1.0) * stationary_vector[option_index] * (1.0 - stationary_vector[option_index]) / chain_count);
+    }
+    uint64_t mixing_step = 0;
+    cout << "Mixing (total variation distance to stationary):" << endl;
+    for (size_t checkpoint_position = 0; checkpoint_position < checkpoint_steps.size(); checkpoint_position++) {
+        double variation_distance = 0.0;
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            double ensemble_share = static_cast<double>(worker_checkpoints[0][checkpoint_position * option_count + option_index]) / chain_count;
+            variation_distance += 0.5 * fabs(ensemble_share - stationary_vector[option_index]);
+        }
+        if (mixing_step == 0 && variation_distance <= 0.25) {
+            mixing_step = checkpoint_steps[checkpoint_position];
+        }
+        cout << "  step " << right << setw(8) << checkpoint_steps[checkpoint_position] << ": " << left
+             << fixed << setprecision(4) << variation_distance << endl;
+    }
+    cout << "Estimated Mixing Time (TV <= 0.25): ";
+    if (mixing_step > 0) {
+        cout << "<= " << mixing_step << " steps" << endl;
+    } else {
+        cout << "not reached within " << step_count << " steps" << endl;
+    }
+    cout << "Sampling Noise Floor: " << fixed << setprecision(4) << noise_floor << endl;
+    cout << "Occupancy Distance (L1, after " << burn_in_steps << " burn-in steps): " << occupancy_distance << endl << endl;
+}
+
+/*
+ * Task pool function running independent tasks on worker threads
+ * Workers claim task numbers from a shared counter; a single worker runs inline
+ */
+void run_parallel_tasks(size_t task_count, size_t worker_count, const function<void(size_t)>& task_body) {
+    size_t active_workers = min(worker_count, task_count);
+    if (active_workers <= 1) {
+        for (size_t task_index = 0; task_index < task_count; task_index++) {
+            task_body(task_index);
+        }
+        return;
+    }
+    atomic<size_t> next_task_index{0};
+    vector<thread> task_workers;
+    for (size_t worker_index = 0; worker_index < active_workers; worker_index++) {
+        task_workers.emplace_back([&]() {
+            for (size_t task_index; (task_index = next_task_index.fetch_add(1)) < task_count;) {
+                task_body(task_index);
+            }
+        });
+    }
+    for (thread& task_worker : task_workers) {
+        task_worker.join();
+    }
+}
+
+/*
+ * Run merge function implementing the MergeShuffle step (Bacher et al., 2015)
+ * Two uniformly shuffled adjacent runs are interleaved by coin flips in place; once
+ * either run is exhausted, the leftovers are inserted at uniform positions
+ */
+void merge_shuffled_runs(vector<string>& choice_container, size_t run_start, size_t run_middle, size_t run_end, const function<uint64_t()>& next_random_word) {
+    size_t first_position = run_start, second_position = run_middle;
+    uint64_t coin_bits = 0;
+    int remaining_bits = 0;
+    
+    while (true) {
+        if (remaining_bits == 0) {
+            coin_bits = next_random_word();
+            remaining_bits = 64;
+        }
+        bool take_second = coin_bits & 1;
+        coin_bits >>= 1;
+        remaining_bits--;
+        
+        if (take_second) {
+            if (second_position == run_end) {
+                break;
+            }
+            swap(choice_container[first_position], choice_container[second_position]);
+            second_position++;
+        } else if (first_position == second_position) {
+            break;
+        }
+        first_position++;
+    }
+    
+    // Fisher-Yates insertion of whatever one run still holds
+    for (; first_position < run_end; first_position++) {
+        size_t insert_position = run_start + map_random_word_to_index(next_random_word(), first_position - run_start + 1);
+        swap(choice_container[first_position], choice_container[insert_position]);
+    }
+}
+
+/*
+ * Parallel shuffle function implementing MergeShuffle over fixed-size blocks
+ * Blocks are Fisher-Yates shuffled independently, then merged pairwise up a binary tree;
+ * every block and merge seeds its own generator from (seed, level, task), so the result is
+ * a pure function of the seed and length. Each pass streams through memory sequentially;
+ * with a secure source every task instead reads its own ChaCha20 keystream
+ */
+void shuffle_options_in_parallel(vector<string>& choice_container, uint64_t shuffle_seed, size_t worker_count,
+                                 const chacha20_generator* secure_source) {
+    size_t option_count = choice_container.size();
+    size_t block_count = (option_count + MERGE_SHUFFLE_BLOCK_LENGTH - 1) / MERGE_SHUFFLE_BLOCK_LENGTH;
+    run_parallel_tasks(block_count, worker_count, [&](size_t block_index) {
+        size_t block_start = block_index * MERGE_SHUFFLE_BLOCK_LENGTH;
+        size_t block_end = min(option_count, block_start + MERGE_SHUFFLE_BLOCK_LENGTH);
+        if (secure_source) {
+            chacha20_generator block_generator;
+            fork_chacha20_generator(*secure_source, 0, static_cast<uint32_t>(block_index), block_generator);
+            for (size_t swap_position = block_end - 1; swap_position > block_start; swap_position--) {
+                size_t partner_position = block_start + map_random_word_to_index(next_chacha20_word(block_generator), swap_position - block_start + 1);
+                swap(choice_container[swap_position], choice_container[partner_position]);
+            }
+            return;
+        }
+        mt19937_64 block_generator(generate_counter_based_word(shuffle_seed, MERGE_SHUFFLE_STREAM, 0, static_cast<uint32_t>(block_index)));
+        for (size_t swap_position = block_end - 1; swap_position > block_start; swap_position--) {
+            size_t partner_position = block_start + map_random_word_to_index(block_generator(), swap_position - block_start + 1);
+            swap(choice_container[swap_position], choice_container[partner_position]);
+        }
+    });
+    
+    uint64_t merge_level = 1;
+    for (size_t run_length = MERGE_SHUFFLE_BLOCK_LENGTH; run_length < option_count; run_length *= 2, merge_level++) {
+        size_t merge_count = (option_count + 2 * run_length - 1) / (2 * run_length);
+        run_parallel_tasks(merge_count, worker_count, [&](size_t merge_index) {
+            size_t run_start = merge_index * 2 * run_length;
+            size_t run_middle = min(option_count, run_start + run_length);
+            size_t run_end = min(option_count, run_start + 2 * run_length);
+            if (run_middle == run_end) {
+                return;
+            }
+            if (secure_source) {
+                chacha20_generator merge_generator;
+                fork_chacha20_generator(*secure_source, static_cast<uint32_t>(merge_level), static_cast<uint32_t>(merge_index), merge_generator);
+                merge_shuffled_runs(choice_container, run_start, run_middle, run_end, [&merge_generator]() {
+                    return next_chacha20_word(merge_generator);
+                });
+            } else {
+                mt19937_64 merge_generator(generate_counter_based_word(shuffle_seed, MERGE_SHUFFLE_STREAM, merge_level, static_cast<uint32_t>(merge_index)));
+                merge_shuffled_runs(choice_container, run_start, run_middle, run_end, [&merge_generator]() {
+                    return merge_generator();
+                });
+            }
+        });
+    }
+}
+
+/*
+ * Exponential key function implementing Efraimidis-Spirakis weighted sampling keys
+ * Sorting -ln(U) / w ascending yields the order of successive draws without replacement;
+ * blocks seed their generators from (seed, block) so keys never depend on the thread count;
+ * with a secure source each block draws its uniforms from a forked ChaCha20 keystream
+ */
+void generate_exponential_keys(const vector<double>& option_weights, uint64_t ordering_seed, vector<ordering_key_entry>& key_entries, size_t worker_count,
+                               const chacha20_generator* secure_source) {
+    size_t option_count = option_weights.size();
+    key_entries.resize(option_count);
+    size_t block_count = (option_count + WEIGHTED_ORDER_BLOCK_LENGTH - 1) / WEIGHTED_ORDER_BLOCK_LENGTH;
+    
+    run_parallel_tasks(block_count, worker_count, [&](size_t block_index) {
+        mt19937_64 block_generator(generate_counter_based_word(ordering_seed, WEIGHTED_ORDER_STREAM, 0, static_cast<uint32_t>(block_index)));
+        chacha20_generator secure_block_generator;
+        if (secure_source) {
+            fork_chacha20_generator(*secure_source, 0, static_cast<uint32_t>(block_index), secure_block_generator);
+        }
+        size_t block_start = block_index * WEIGHTED_ORDER_BLOCK_LENGTH;
+        size_t block_end = min(option_count, block_start + WEIGHTED_ORDER_BLOCK_LENGTH);
+        
+        // Branch-free pass: U in [0, 1) so -log1p(-U) is never negative, and the + 0.0 folds a
+        // signed zero away; the unsigned radix sort relies on both. Zero weights are set to
+        // +infinity outright and trail the order
+        for (size_t option_index = block_start; option_index < block_end; option_index++) {
+            uint64_t random_word = secure_source ? next_chacha20_word(secure_block_generator) : block_generator();
+            double uniform_value = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0);
+            double option_weight = option_weights[option_index];
+            double exponential_key = option_weight > 0.0 ? -log1p(-uniform_value) / option_weight + 0.0
+                                                         : HUGE_VAL;
+            uint64_t key_bits;
+            memcpy(&key_bits, &exponential_key, sizeof(key_bits));
+            key_entries[option_index].key_bits = key_bits;
+            key_entries[option_index].option_index = static_cast<uint32_t>(option_index);
+        }
+    });
+}
+
+/*
+ * Radix sort function implementing a parallel stable LSD sort on 11-bit key digits
+ * Workers histogram their slices, offsets are laid out digit-major, then each worker
+ * scatters its slice; passes where every key shares the digit are skipped entirely
+ */
+void radix_sort_key_entries(vector<ordering_key_entry>& key_entries, size_t worker_count) {
+    size_t entry_count = key_entries.size();
+    size_t slice_count = max<size_t>(1, min(worker_count, entry_count / WEIGHTED_ORDER_BLOCK_LENGTH));
+    vector<ordering_key_entry> scatter_buffer(entry_count);
+    vector<array<size_t, RADIX_BUCKET_COUNT>> digit_counts(slice_count);
+    
+    for (int digit_shift = 0; digit_shift < 64; digit_shift += RADIX_DIGIT_BITS) {
+        run_parallel_tasks(slice_count, worker_count, [&](size_t slice_index) {
+            digit_counts[slice_index].fill(0);
+            size_t slice_end = entry_count * (slice_index + 1) / slice_count;
+            for (size_t entry_index = entry_count * slice_index / slice_count; entry_index < slice_end; entry_index++) {
+                digit_counts[slice_index][(key_entries[entry_index].key_bits >> digit_shift) & (RADIX_BUCKET_COUNT - 1)]++;
+            }
+        });
+        
+        // Offsets: all slices' entries for digit d precede digit d + 1; slices keep input order
+        size_t running_offset = 0;
+        bool single_digit_pass = false;
+        for (size_t digit_value = 0; digit_value < RADIX_BUCKET_COUNT; digit_value++) {
+            size_t digit_total = 0;
+            for (size_t slice_index = 0; slice_index < slice_count; slice_index++) {
+                size_t slice_digit_count = digit_counts[slice_index][digit_value];
+                digit_counts[slice_index][digit_value] = running_offset;
+                running_offset += slice_digit_count;
+                digit_total += slice_digit_count;
+            }
+            single_digit_pass = single_digit_pass || digit_total == entry_count;
+        }
+        if (single_digit_pass) {
+            continue;
+        }
+        
+        run_parallel_tasks(slice_count, worker_count, [&](size_t slice_index) {
+            array<size_t, RADIX_BUCKET_COUNT>& scatter_offsets = digit_counts[slice_index];
+            size_t slice_end = entry_count * (slice_index + 1) / slice_count;
+            for (size_t entry_index = entry_count * slice_index / slice_count; entry_index < slice_end; entry_index++) {
+                const ordering_key_entry& key_entry = key_entries[entry_index];
+                scatter_buffer[scatter_offsets[(key_entry.key_bits >> digit_shift) & (RADIX_BUCKET_COUNT - 1)]++] = key_entry;
+            }
+        });
+        key_entries.swap(scatter_buffer);
+    }
+}
+
+/*
+ * Weighted ordering function returning option indices in draw-without-replacement order
+ * Near-linear in the option count, replacing n successive spin-and-remove rounds
+ */
+vector<uint32_t> compute_weighted_ordering(const vector<double>& option_weights, uint64_t ordering_seed, size_t worker_count,
+                                           const chacha20_generator* secure_source) {
+    vector<ordering_key_entry> key_entries;
+    generate_exponential_keys(option_weights, ordering_seed, key_entries, worker_count, secure_source);
+    radix_sort_key_entries(key_entries, worker_count);
+    
+    vector<uint32_t> option_order(key_entries.size());
+    for (size_t rank_index = 0; rank_index < key_entries.size(); rank_index++) {
+        option_order[rank_index] = key_entries[rank_index].option_index;
+    }
+    return option_order;
+}
+
+/*
+ * Full shuffle function implementing queue and draft ordering of every option
+ * Weighted mode ranks options like successive draws without replacement;
+ * seeded sessions reproduce the order of each spin number exactly
+ */
+void execute_full_shuffle(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: FULL RANDOM ORDERING" << endl;
+    cout << "-----------------------------" << endl;
+    
+    // Secure sessions hand the kernel-keyed ChaCha20 state to every shuffle task directly
+    uint64_t shuffle_seed = 0;
+    chacha20_generator secure_generator;
+    const chacha20_generator* secure_source = nullptr;
+    if (session_configuration.counter_based_mode) {
+        shuffle_seed = generate_counter_based_word(session_configuration.session_seed, compute_wheel_identifier(choice_container),
+                                                   session_configuration.spin_number, FINAL_SELECTION_LANE);
+    } else if (session_configuration.secure_mode) {
+        seed_chacha20_generator(secure_generator);
+        secure_source = &secure_generator;
+    } else {
+        shuffle_seed = acquire_thread_local_generator()();
+    }
+    
+    vector<string> shuffled_options = choice_container;
+    size_t worker_count = max(1u, thread::hardware_concurrency());
+    auto shuffle_start = chrono::steady_clock::now();
+    if (session_configuration.weighted_shuffle) {
+        vector<double> ordering_weights = option_weights;
+        ordering_weights.resize(choice_container.size(), 1.0);
+        vector<uint32_t> option_order = compute_weighted_ordering(ordering_weights, shuffle_seed, worker_count, secure_source);
+        for (size_t rank_index = 0; rank_index < option_order.size(); rank_index++) {
+            shuffled_options[rank_index] = choice_container[option_order[rank_index]];
+        }
+    } else {
+        shuffle_options_in_parallel(shuffled_options, shuffle_seed, worker_count, secure_source);
+        effective_draw_model draw_model;
+        build_effective_draw_model(draw_model, choice_container, option_weights, nullptr, session_configuration);
+        if (draw_model.weighted_draw) {
+            cout << "NOTE: --shuffle orders options uniformly and ignores their weights; use --weighted-shuffle to order by weight" << endl;
+        }
+    }
+    auto shuffle_duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - shuffle_start);
+    
+    if (session_configuration.weighted_shuffle) {
+        cout << "Shuffle Method: Weighted exponential keys + LSD radix sort (" << worker_count << " threads)" << endl;
+    } else {
+        cout << "Shuffle Method: MergeShuffle (" << worker_count << " threads, " << MERGE_SHUFFLE_BLOCK_LENGTH << "-option blocks)" << endl;
+    }
+    cout << "Shuffle Time: " << shuffle_duration.count() << " microseconds" << endl << endl;
+    
+    size_t displayed_options = min<size_t>(shuffled_options.size(), 100);
+    for (size_t rank_index = 0; rank_index < displayed_options; rank_index++) {
+        cout << "| " << right << setw(6) << (rank_index + 1) << ". " << left << shuffled_options[rank_index] << endl;
+    }
+    if (displayed_options < shuffled_options.size()) {
+        cout << "| ... " << shuffled_options.size() - displayed_options << " more options" << endl;
+    }
+    cout << endl;
+}
+
+/*
+ * Physical wheel construction function laying out sectors proportional to weight
+ */
+void build_physical_wheel(physical_wheel& spin_wheel, const vector<double>& option_weights) {
+    double total_weight = 0.0;
+    for (double option_weight : option_weights) {
+        total_weight += option_weight;
+    }
+    
+    spin_wheel.sector_starts.resize(option_weights.size());
+    double running_weight = 0.0;
+    for (size_t option_index = 0; option_index < option_weights.size(); option_index++) {
+        double start_fraction = (total_weight > 0.0) ? min(1.0, running_weight / total_weight) : 0.0;
+        spin_wheel.sector_starts[option_index] = static_cast<uint32_t>(min<double>(start_fraction * PHYSICS_ANGLE_UNITS_PER_TURN,
+                                                                                    PHYSICS_ANGLE_UNITS_PER_TURN - 1));
+        running_weight += option_weights[option_index];
+    }
+    
+    // Quantized lookup table: one merge sweep assigns every bucket its starting sector
+    size_t bucket_count = PHYSICS_MIN_LOOKUP_BUCKETS;
+    uint32_t bucket_bits = 6;
+    while (bucket_count < 2 * option_weights.size() && bucket_count < PHYSICS_MAX_LOOKUP_BUCKETS) {
+        bucket_count <<= 1;
+        bucket_bits++;
+    }
+    spin_wheel.bucket_shift = 32 - bucket_bits;
+    spin_wheel.bucket_sectors.assign(bucket_count + 1, 0);
+    size_t covering_sector = 0;
+    for (size_t bucket_index = 0; bucket_index <= bucket_count; bucket_index++) {
+        uint32_t bucket_angle = (bucket_index == bucket_count) ? UINT32_MAX : static_cast<uint32_t>(bucket_index << spin_wheel.bucket_shift);
+        while (covering_sector + 1 < spin_wheel.sector_starts.size() && spin_wheel.sector_starts[covering_sector + 1] <= bucket_angle) {
+            covering_sector++;
+        }
+        spin_wheel.bucket_sectors[bucket_index] = static_cast<uint32_t>(covering_sector);
+    }
+}
+
+/*
+ * Spin launch function deriving start angle and launch velocity from one random word
+ * The uniform start angle alone makes the resting angle uniform, so sector areas are
+ * the exact outcome probabilities whatever the velocity spread
+ */
+physical_spin_state launch_physical_spin(uint64_t random_word) {
+    physical_spin_state spin_state;
+    spin_state.wheel_angle = random_word & 0xFFFFFFFFULL;
+    spin_state.angular_velocity = PHYSICS_MIN_LAUNCH_VELOCITY +
+        static_cast<int64_t>(((random_word >> 32) * static_cast<uint64_t>(PHYSICS_MAX_LAUNCH_VELOCITY - PHYSICS_MIN_LAUNCH_VELOCITY)) >> 32);
+    return spin_state;
+}
+
+/*
+ * Integration function advancing a spin by one fixed step (semi-implicit Euler)
+ * Friction is applied to the velocity first, then the new velocity moves the angle
+ */
+bool advance_physical_spin(physical_spin_state& spin_state) {
+    if (spin_state.angular_velocity <= 0) {
+        return false;
+    }
+    spin_state.angular_velocity -= PHYSICS_FRICTION_PER_STEP;
+    spin_state.elapsed_steps++;
+    if (spin_state.angular_velocity <= 0) {
+        spin_state.angular_velocity = 0;
+        return false;
+    }
+    spin_state.wheel_angle += static_cast<uint64_t>(spin_state.angular_velocity);
+    return true;
+}
+
+/*
+ * Duration function returning the integration steps left before the wheel rests
+ */
+uint64_t count_remaining_physical_steps(const physical_spin_state& spin_state) {
+    if (spin_state.angular_velocity <= 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>((spin_state.angular_velocity - 1) / PHYSICS_FRICTION_PER_STEP) + 1;
+}
+
+/*
+ * Closed-form stopping function summing the integrator's arithmetic velocity series
+ * With M moving steps left: angle += M * v - friction * M * (M + 1) / 2, in exact integers
+ */
+uint32_t compute_stopping_angle(const physical_spin_state& spin_state) {
+    if (spin_state.angular_velocity <= 0) {
+        return static_cast<uint32_t>(spin_state.wheel_angle);
+    }
+    uint64_t moving_steps = static_cast<uint64_t>((spin_state.angular_velocity - 1) / PHYSICS_FRICTION_PER_STEP);
+    uint64_t travelled_angle = moving_steps * static_cast<uint64_t>(spin_state.angular_velocity)
+                               - static_cast<uint64_t>(PHYSICS_FRICTION_PER_STEP) * (moving_steps * (moving_steps + 1) / 2);
+    return static_cast<uint32_t>(spin_state.wheel_angle + travelled_angle);
+}
+
+/*
+ * Sector lookup function returning the sector that contains an angle in O(1)
+ * The angle's bucket gives the first candidate; only boundaries inside that bucket are
+ * checked, by a short scan or, for crowded buckets, a binary search limited to them.
+ * Zero-width sectors share a start with their successor and are never returned
+ */
+size_t locate_physical_sector(const physical_wheel& spin_wheel, uint32_t wheel_angle) {
+    size_t bucket_index = wheel_angle >> spin_wheel.bucket_shift;
+    size_t covering_sector = spin_wheel.bucket_sectors[bucket_index];
+    size_t last_candidate = spin_wheel.bucket_sectors[bucket_index + 1];
+    if (last_candidate - covering_sector > PHYSICS_BUCKET_SCAN_LIMIT) {
+        return static_cast<size_t>(upper_bound(spin_wheel.sector_starts.begin() + covering_sector + 1,
+                                               spin_wheel.sector_starts.begin() + last_candidate + 1, wheel_angle)
+                                   - spin_wheel.sector_starts.begin()) - 1;
+    }
+    while (covering_sector < last_candidate && spin_wheel.sector_starts[covering_sector + 1] <= wheel_angle) {
+        covering_sector++;
+    }
+    return covering_sector;
+}
+
+/*
+ * Batch launch function starting one wheel per lane and locating its first peg
+ * Wheels are placed in order of decreasing launch velocity. Lanes are padded to whole
+ * groups; padding lanes start at rest and never reach a peg. Resting angles are read
+ * from resting_angles, by launch index, once step_physical_batch returns false
+ */
+void launch_physical_batch(physical_spin_batch& spin_batch, const physical_wheel& spin_wheel, const vector<uint64_t>& launch_words) {
+    size_t lane_count = launch_words.size();
+    size_t group_count = (lane_count + PHYSICS_LANE_GROUP - 1) / PHYSICS_LANE_GROUP;
+    size_t sector_count = spin_wheel.sector_starts.size();
+    physical_lane_group resting_group;
+    fill(begin(resting_group.wheel_angles), end(resting_group.wheel_angles), 0);
+    fill(begin(resting_group.angular_velocities), end(resting_group.angular_velocities), 0);
+    fill(begin(resting_group.peg_gaps), end(resting_group.peg_gaps), UINT32_MAX);
+    spin_batch.lane_groups.assign(group_count, resting_group);
+    spin_batch.next_peg_sectors.assign(group_count * PHYSICS_LANE_GROUP, 0);
+    spin_batch.lane_spins.assign(group_count * PHYSICS_LANE_GROUP, 0);
+    spin_batch.resting_angles.assign(lane_count, 0);
+    spin_batch.group_events.assign(group_count, 0);
+    spin_batch.active_lane_count = lane_count;
+    
+    // Friction slows every wheel equally, so velocity order is also stopping order
+    vector<physical_spin_state> launched_spins(lane_count);
+    for (size_t launch_index = 0; launch_index < lane_count; launch_index++) {
+        launched_spins[launch_index] = launch_physical_spin(launch_words[launch_index]);
+        spin_batch.lane_spins[launch_index] = static_cast<uint32_t>(launch_index);
+    }
+    stable_sort(spin_batch.lane_spins.begin(), spin_batch.lane_spins.begin() + lane_count, [&](uint32_t first_launch, uint32_t second_launch) {
+        return launched_spins[first_launch].angular_velocity > launched_spins[second_launch].angular_velocity;
+    });
+    
+    for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+        physical_lane_group& lane_group = spin_batch.lane_groups[lane_index / PHYSICS_LANE_GROUP];
+        size_t lane_offset = lane_index % PHYSICS_LANE_GROUP;
+        const physical_spin_state& spin_state = launched_spins[spin_batch.lane_spins[lane_index]];
+        uint32_t wheel_angle = static_cast<uint32_t>(spin_state.wheel_angle);
+        size_t opened_sector = (locate_physical_sector(spin_wheel, wheel_angle) + 1) % sector_count;
+        lane_group.wheel_angles[lane_offset] = wheel_angle;
+        lane_group.angular_velocities[lane_offset] = static_cast<int32_t>(spin_state.angular_velocity);
+        lane_group.peg_gaps[lane_offset] = spin_wheel.sector_starts[opened_sector] - wheel_angle - 1;
+        spin_batch.next_peg_sectors[lane_index] = static_cast<uint32_t>(opened_sector);
+    }
+}
+
+/*
+ * Batch retirement function moving wheels that came to rest out of the active lanes
+ * Only groups that raised a stop event are visited. Each stopped wheel records its resting
+ * angle and the last moving wheel is swapped into its lane; the vacated lane becomes padding
+ */
+void retire_stopped_lanes(physical_spin_batch& spin_batch, size_t group_count) {
+    for (size_t group_index = 0; group_index < group_count; group_index++) {
+        if (!(spin_batch.group_events[group_index] & PHYSICS_EVENT_WHEEL_STOPPED)) {
+            continue;
+        }
+        for (size_t lane_offset = 0; lane_offset < PHYSICS_LANE_GROUP; lane_offset++) {
+            size_t lane_index = group_index * PHYSICS_LANE_GROUP + lane_offset;
+            physical_lane_group& lane_group = spin_batch.lane_groups[group_index];
+            
+            // The wheel swapped in may itself have stopped this step, so retire until the lane moves
+            while (lane_index < spin_batch.active_lane_count && lane_group.angular_velocities[lane_offset] == 0) {
+                spin_batch.resting_angles[spin_batch.lane_spins[lane_index]] = lane_group.wheel_angles[lane_offset];
+                size_t last_lane = --spin_batch.active_lane_count;
+                physical_lane_group& last_group = spin_batch.lane_groups[last_lane / PHYSICS_LANE_GROUP];
+                size_t last_offset = last_lane % PHYSICS_LANE_GROUP;
+                
+                lane_group.wheel_angles[lane_offset] = last_group.wheel_angles[last_offset];
+                lane_group.angular_velocities[lane_offset] = last_group.angular_velocities[last_offset];
+                lane_group.peg_gaps[lane_offset] = last_group.peg_gaps[last_offset];
+                spin_batch.next_peg_sectors[lane_index] = spin_batch.next_peg_sectors[last_lane];
+                spin_batch.lane_spins[lane_index] = spin_batch.lane_spins[last_lane];
+                
+                last_group.wheel_angles[last_offset] = 0;
+                last_group.angular_velocities[last_offset] = 0;
+                last_group.peg_gaps[last_offset] = UINT32_MAX;
+            }
+        }
+    }
+}
+
+/*
+ * Batch step function advancing every moving lane by one fixed step; true while any wheel moves
+ * Each group is a fixed-length branch-free loop over the active groups only. Without pegs
+ * only angle and velocity are touched and stopped wheels leave from the tail; with pegs the
+ * gaps are tracked too, contacts and stops mark their group, and marked groups are resolved
+ * afterwards in scalar passes
+ */
+bool step_physical_batch(physical_spin_batch& spin_batch, const physical_wheel& spin_wheel, const peg_configuration& peg_model) {
+    const int32_t friction_per_step = static_cast<int32_t>(PHYSICS_FRICTION_PER_STEP);
+    size_t group_count = (spin_batch.active_lane_count + PHYSICS_LANE_GROUP - 1) / PHYSICS_LANE_GROUP;
+    uint32_t any_event = 0;
+    
+    if (!peg_model.pegs_enabled) {
+        for (size_t group_index = 0; group_index < group_count; group_index++) {
+            physical_lane_group& lane_group = spin_batch.lane_groups[group_index];
+            for (size_t lane_offset = 0; lane_offset < PHYSICS_LANE_GROUP; lane_offset++) {
+                int32_t slowed_velocity = lane_group.angular_velocities[lane_offset] - friction_per_step;
+                slowed_velocity = (slowed_velocity > 0) ? slowed_velocity : 0;
+                lane_group.angular_velocities[lane_offset] = slowed_velocity;
+                lane_group.wheel_angles[lane_offset] += static_cast<uint32_t>(slowed_velocity);
+            }
+        }
+        
+        // Lanes hold wheels in stopping order, so every wheel that just came to rest is at the tail
+        size_t& active_lane_count = spin_batch.active_lane_count;
+        while (active_lane_count > 0) {
+            size_t last_lane = active_lane_count - 1;
+            const physical_lane_group& last_group = spin_batch.lane_groups[last_lane / PHYSICS_LANE_GROUP];
+            if (last_group.angular_velocities[last_lane % PHYSICS_LANE_GROUP] != 0) {
+                break;
+            }
+            spin_batch.resting_angles[spin_batch.lane_spins[last_lane]] = last_group.wheel_angles[last_lane % PHYSICS_LANE_GROUP];
+            active_lane_count--;
+        }
+        return active_lane_count > 0;
+    }
+    
+    // A wheel stops this step exactly when its velocity lies in [1, friction]
+    for (size_t group_index = 0; group_index < group_count; group_index++) {
+        physical_lane_group& lane_group = spin_batch.lane_groups[group_index];
+        uint32_t group_event = 0;
+        for (size_t lane_offset = 0; lane_offset < PHYSICS_LANE_GROUP; lane_offset++) {
+            int32_t angular_velocity = lane_group.angular_velocities[lane_offset];
+            int32_t slowed_velocity = angular_velocity - friction_per_step;
+            slowed_velocity = (slowed_velocity > 0) ? slowed_velocity : 0;
+            uint32_t travelled_angle = static_cast<uint32_t>(slowed_velocity);
+            group_event |= (travelled_angle > lane_group.peg_gaps[lane_offset]) * PHYSICS_EVENT_PEG_CROSSING;
+            group_event |= (static_cast<uint32_t>(angular_velocity - 1) < static_cast<uint32_t>(friction_per_step)) * PHYSICS_EVENT_WHEEL_STOPPED;
+            lane_group.angular_velocities[lane_offset] = slowed_velocity;
+            lane_group.wheel_angles[lane_offset] += travelled_angle;
+            lane_group.peg_gaps[lane_offset] -= travelled_angle;
+        }
+        spin_batch.group_events[group_index] = static_cast<uint8_t>(group_event);
+        any_event |= group_event;
+    }
+    
+    // Lanes that passed a boundary pay the peg (or rebound) and measure the gap to the next one
+    size_t sector_count = spin_wheel.sector_starts.size();
+    for (size_t group_index = 0; (any_event & PHYSICS_EVENT_PEG_CROSSING) && group_index < group_count; group_index++) {
+        if (!(spin_batch.group_events[group_index] & PHYSICS_EVENT_PEG_CROSSING)) {
+            continue;
+        }
+        physical_lane_group& lane_group = spin_batch.lane_groups[group_index];
+        for (size_t lane_offset = 0; lane_offset < PHYSICS_LANE_GROUP; lane_offset++) {
+            // The gap wrapped exactly when it now exceeds 2^32 minus the distance just travelled;
+            // its complement is then the overshoot past the peg
+            int32_t& angular_velocity = lane_group.angular_velocities[lane_offset];
+            if (lane_group.peg_gaps[lane_offset] <= UINT32_MAX - static_cast<uint32_t>(angular_velocity)) {
+                continue;
+            }
+            uint32_t& next_peg_sector = spin_batch.next_peg_sectors[group_index * PHYSICS_LANE_GROUP + lane_offset];
+            int64_t remaining_gap = -static_cast<int64_t>(static_cast<uint32_t>(~lane_group.peg_gaps[lane_offset]));
+            
+            // A fast step may pass several narrow sectors; each peg is resolved in order
+            while (remaining_gap <= 0) {
+                if (angular_velocity < peg_model.clearance_velocity) {
+                    // Too slow to clear the peg: the wheel rests just before it
+                    lane_group.wheel_angles[lane_offset] += static_cast<uint32_t>(remaining_gap) - 1;
+                    angular_velocity = 0;
+                    remaining_gap = 1;
+                    spin_batch.group_events[group_index] |= PHYSICS_EVENT_WHEEL_STOPPED;
+                    any_event |= PHYSICS_EVENT_WHEEL_STOPPED;
+                    break;
+                }
+                angular_velocity = static_cast<int32_t>(max<int64_t>(1, angular_velocity - peg_model.peg_impulse));
+                size_t opened_sector = (next_peg_sector + 1 < sector_count) ? next_peg_sector + 1 : 0;
+                uint32_t passed_width = spin_wheel.sector_starts[opened_sector] - spin_wheel.sector_starts[next_peg_sector];
+                remaining_gap += (passed_width == 0 && sector_count == 1) ? static_cast<int64_t>(PHYSICS_ANGLE_UNITS_PER_TURN) : passed_width;
+                next_peg_sector = static_cast<uint32_t>(opened_sector);
+            }
+            lane_group.peg_gaps[lane_offset] = static_cast<uint32_t>(remaining_gap - 1);
+        }
+    }
+    
+    if (any_event & PHYSICS_EVENT_WHEEL_STOPPED) {
+        retire_stopped_lanes(spin_batch, group_count);
+    }
+    return spin_batch.active_lane_count > 0;
+}
+
+/*
+ * Batch physics analysis function implementing distribution and peg stress checks
+ * Spins run in SoA batches; observed sector shares are compared with the weights
+ * by chi-square for a frictionless pointer and for light and heavy pegs
+ */
+void display_physical_batch_analysis(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 7: PHYSICAL DISTRIBUTION CHECK" << endl;
+    cout << "------------------------------------" << endl;
+    
+    vector<double> sector_weights = option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights;
+    physical_wheel spin_wheel;
+    build_physical_wheel(spin_wheel, sector_weights);
+    double total_weight = 0.0;
+    for (double sector_weight : sector_weights) {
+        total_weight += sector_weight;
+    }
+    
+    const peg_configuration peg_models[] = {
+        {"No pegs", false, 0, 0},
+        {"Light pegs", true, PHYSICS_FRICTION_PER_STEP * 3, PHYSICS_FRICTION_PER_STEP * 4},
+        {"Heavy pegs", true, PHYSICS_FRICTION_PER_STEP * 20, PHYSICS_FRICTION_PER_STEP * 40}
+    };
+    uint64_t batch_seed = session_configuration.counter_based_mode ? session_configuration.session_seed : acquire_thread_local_generator()();
+    uint64_t wheel_identifier = compute_wheel_identifier(choice_container);
+    uint64_t spin_total = session_configuration.physics_batch_count;
+    
+    cout << "Simulated Spins: " << spin_total << " per peg model (" << PHYSICS_BATCH_LANES << " wheels per batch)" << endl << endl;
+    
+    for (const peg_configuration& peg_model : peg_models) {
+        vector<uint64_t> sector_counts(choice_container.size(), 0);
+        physical_spin_batch spin_batch;
+        vector<uint64_t> launch_words;
+        uint64_t wheel_steps = 0;
+        auto batch_start = chrono::steady_clock::now();
+        
+        // Every model replays the same launches so differences come from the pegs alone
+        for (uint64_t first_spin = 0; first_spin < spin_total; first_spin += PHYSICS_BATCH_LANES) {
+            size_t lane_count = static_cast<size_t>(min<uint64_t>(PHYSICS_BATCH_LANES, spin_total - first_spin));
+            launch_words.resize(lane_count);
+            for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+                launch_words[lane_index] = generate_counter_based_word(batch_seed, wheel_identifier, first_spin + lane_index, FINAL_SELECTION_LANE);
+            }
+            launch_physical_batch(spin_batch, spin_wheel, launch_words);
+            do {
+                wheel_steps += spin_batch.active_lane_count;
+            } while (step_physical_batch(spin_batch, spin_wheel, peg_model));
+            for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+                sector_counts[locate_physical_sector(spin_wheel, spin_batch.resting_angles[lane_index])]++;
+            }
+        }
+        double batch_seconds = chrono::duration<double>(chrono::steady_clock::now() - batch_start).count();
+        
+        double chi_square = 0.0, largest_deviation = 0.0;
+        size_t degrees_of_freedom = 0;
+        for (size_t option_index = 0; option_index < choice_container.size(); option_index++) {
+            double expected_count = spin_total * sector_weights[option_index] / total_weight;
+            if (expected_count > 0.0) {
+                chi_square += (sector_counts[option_index] - expected_count) * (sector_counts[option_index] - expected_count) / expected_count;
+                degrees_of_freedom++;
+            }
+            largest_deviation = max(largest_deviation, fabs(100.0 * (sector_counts[option_index] - expected_count) / spin_total));
+        }
+        cout << peg_model.model_label << ": chi-square " << fixed << setprecision(1) << chi_square
+             << " (df " << (degrees_of_freedom > 0 ? degrees_of_freedom - 1 : 0) << "), largest share deviation "
+             << setprecision(3) << largest_deviation << " points, " << setprecision(2)
+             << batch_seconds * 1e9 / max<uint64_t>(1, wheel_steps) << " ns per wheel-step" << endl;
+        
+        size_t displayed_options = min<size_t>(choice_container.size(), 20);
+        for (size_t option_index = 0; option_index < displayed_options; option_index++) {
+            cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15) << choice_container[option_index]
+                 << " | expected " << right << setw(8) << setprecision(3) << 100.0 * sector_weights[option_index] / total_weight
+                 << "% | observed " << setw(8) << 100.0 * sector_counts[option_index] / spin_total << "% |" << endl;
+        }
+        cout << left << endl;
+    }
+    
+    // Scalar reference: the single-spin integrator on the same launches
+    uint64_t scalar_spins = min<uint64_t>(spin_total, 20000), scalar_steps = 0;
+    auto scalar_start = chrono::steady_clock::now();
+    for (uint64_t spin_index = 0; spin_index < scalar_spins; spin_index++) {
+        physical_spin_state spin_state = launch_physical_spin(generate_counter_based_word(batch_seed, wheel_identifier, spin_index, FINAL_SELECTION_LANE));
+        while (advance_physical_spin(spin_state)) {
+        }
+        scalar_steps += spin_state.elapsed_steps;
+    }
+    double scalar_seconds = chrono::duration<double>(chrono::steady_clock::now() - scalar_start).count();
+    cout << "Scalar Integrator Reference: " << fixed << setprecision(2) << scalar_seconds * 1e9 / max<uint64_t>(1, scalar_steps)
+         << " ns per wheel-step" << endl << endl;
+}
+
+/*
+ * Clip composition function laying the rotation phases and result onto a synthetic clock
+ * Physical spins show each phase at its simulated time (phase k at k/6 of the spin);
+ * other spins advance one phase every RECORDING_PHASE_SECONDS (spin_duration_steps == 0)
+ */
+void append_rotation_clip(spin_recording& recording, const vector<string>& choice_container, const vector<int>& phase_indices,
+                          int final_index, uint64_t spin_duration_steps) {
+    size_t phase_count = phase_indices.size();
+    auto phase_time = [&](size_t phase_number) -> double {
+        if (spin_duration_steps == 0) {
+            return RECORDING_PHASE_SECONDS * phase_number;
+        }
+        return static_cast<double>(spin_duration_steps * phase_number / (phase_count + 1)) / PHYSICS_STEPS_PER_SECOND;
+    };
+    
+    recording.event_times.push_back(0.0);
+    recording.event_texts.push_back("PHASE 2: WHEEL SIMULATION EXECUTION\n-----------------------------------\n"
+                                    "Executing wheel rotation simulation...\n\n");
+    for (size_t phase_number = 1; phase_number <= phase_count; phase_number++) {
+        recording.event_times.push_back(phase_time(phase_number));
+        recording.event_texts.push_back("Rotation Phase " + to_string(phase_number) + ": " + choice_container[phase_indices[phase_number - 1]] + " -> ");
+    }
+    
+    double final_time = (spin_duration_steps == 0) ? phase_time(phase_count + 1)
+                                                   : static_cast<double>(spin_duration_steps) / PHYSICS_STEPS_PER_SECOND;
+    recording.event_times.push_back(final_time);
+    recording.event_texts.push_back("FINALIZING SELECTION...\n\n"
+                                    "========================================\n"
+                                    "           SELECTION RESULTS            \n"
+                                    "========================================\n"
+                                    "SELECTED OPTION: " + choice_container[final_index] + "\n"
+                                    "Selection Index: " + to_string(final_index + 1) + " of " + to_string(choice_container.size()) + "\n"
+                                    "========================================\n");
+    recording.event_times.push_back(final_time + RECORDING_RESULT_HOLD_SECONDS);
+    recording.event_texts.push_back("\n");
+}
+
+/*
+ * JSON string escaping function for cast headers and events
+ * Quotes, backslashes and control bytes are escaped; UTF-8 text passes through unchanged
+ */
+string escape_json_text(const string& raw_text) {
+    string escaped_text;
+    escaped_text.reserve(raw_text.size() + 8);
+    for (unsigned char text_byte : raw_text) {
+        if (text_byte == '"' || text_byte == '\\') {
+            escaped_text += '\\';
+            escaped_text += static_cast<char>(text_byte);
+        } else if (text_byte == '\n') {
+            escaped_text += "\\n";
+        } else if (text_byte == '\r') {
+            escaped_text += "\\r";
+        } else if (text_byte < 0x20) {
+            const char* hex_digits = "0123456789abcdef";
+            escaped_text += "\\u00";
+            escaped_text += hex_digits[text_byte >> 4];
+            escaped_text += hex_digits[text_byte & 0x0F];
+        } else {
+            escaped_text += static_cast<char>(text_byte);
+        }
+    }
+    return escaped_text;
+}
+
+/*
+ * Cast writer function producing an asciinema v2 file: a JSON header line followed by
+ * one [time, "o", text] event per line. Terminal output needs CR LF line breaks
+ */
+bool write_cast_recording(const spin_recording& recording, const string& output_path, const string& clip_title) {
+    ostringstream cast_stream;
+    cast_stream << "{\"version\": 2, \"width\": " << RECORDING_TERMINAL_WIDTH << ", \"height\": " << RECORDING_TERMINAL_HEIGHT
+                << ", \"title\": \"" << escape_json_text(clip_title) << "\"}\n";
+    cast_stream << fixed << setprecision(6);
+    for (size_t event_index = 0; event_index < recording.event_texts.size(); event_index++) {
+        string terminal_text;
+        for (char text_character : recording.event_texts[event_index]) {
+            if (text_character == '\n') {
+                terminal_text += '\r';
+            }
+            terminal_text += text_character;
+        }
+        cast_stream << "[" << recording.event_times[event_index] << ", \"o\", \"" << escape_json_text(terminal_text) << "\"]\n";
+    }
+    
+    ofstream output_stream(output_path, ios::binary);
+    string cast_text = cast_stream.str();
+    if (!output_stream.write(cast_text.data(), static_cast<streamsize>(cast_text.size()))) {
+        cout << "ERROR: Unable to write recording " << output_path << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Directory creation function making every missing component of an output path
+ * POSIX mkdir (_mkdir on Windows) keeps the program within C++11; components that
+ * already exist as directories are accepted
+ */
+bool create_output_directory(const string& directory_path) {
+    for (size_t separator_position = 0; separator_position != string::npos;) {
+        separator_position = directory_path.find_first_of("/\\", separator_position + 1);
+        string partial_path = directory_path.substr(0, separator_position);
+        if (partial_path.empty()) {
+            continue;
+        }
+#if defined(_WIN32)
+        int creation_result = _mkdir(partial_path.c_str());
+#else
+        int creation_result = mkdir(partial_path.c_str(), 0755);
+#endif
+        if (creation_result != 0 && errno != EEXIST) {
+            return false;
+        }
+    }
+    struct stat directory_status;
+    return stat(directory_path.c_str(), &directory_status) == 0 && (directory_status.st_mode & S_IFMT) == S_IFDIR;
+}
+
+/*
+ * Frame directory writer function storing the full screen after every event
+ * frame_NNNNN.txt holds the cumulative output; timing.txt maps each frame to its time
+ */
+bool write_frame_directory(const spin_recording& recording, const string& directory_path) {
+    bool directory_created = create_output_directory(directory_path);
+    ofstream timing_stream(directory_path + "/timing.txt", ios::binary);
+    if (!directory_created || !timing_stream) {
+        cout << "ERROR: Unable to create frame directory " << directory_path << endl;
+        return false;
+    }
+    
+    string screen_text;
+    timing_stream << fixed << setprecision(6);
+    for (size_t event_index = 0; event_index < recording.event_texts.size(); event_index++) {
+        screen_text += recording.event_texts[event_index];
+        ostringstream frame_name;
+        frame_name << "frame_" << setw(5) << setfill('0') << event_index << ".txt";
+        ofstream frame_stream(directory_path + "/" + frame_name.str(), ios::binary);
+        if (!frame_stream.write(screen_text.data(), static_cast<streamsize>(screen_text.size()))) {
+            cout << "ERROR: Unable to write frame " << frame_name.str() << endl;
+            return false;
+        }
+        timing_stream << frame_name.str() << "\t" << recording.event_times[event_index] << "\n";
+    }
+    return static_cast<bool>(timing_stream);
+}
+
+/*
+ * Recording dispatch function: paths ending in .cast become asciinema files, anything
+ * else a frame directory
+ */
+bool save_spin_recording(const spin_recording& recording, const string& output_path, const string& clip_title) {
+    const string cast_suffix = ".cast";
+    if (output_path.size() >= cast_suffix.size() &&
+        output_path.compare(output_path.size() - cast_suffix.size(), cast_suffix.size(), cast_suffix) == 0) {
+        return write_cast_recording(recording, output_path, clip_title);
+    }
+    return write_frame_directory(recording, output_path);
+}
+
+/*
+ * Clip rendering function recomputing one counter-based spin without running it live
+ * Draws use the same (seed, wheel, spin, lane) words as execute_wheel_simulation, so a
+ * clip shows exactly the phases and winner that the spin itself would print.
+ * An empty spin_wheel selects draw-model draws; otherwise the physical spin is integrated
+ */
+size_t render_counter_based_clip(const vector<string>& choice_container, const physical_wheel& spin_wheel, const effective_draw_model& draw_model,
+                                 const wheel_session_configuration& session_configuration, uint64_t spin_number, spin_recording& recording) {
+    uint64_t wheel_identifier = compute_wheel_identifier(choice_container);
+    auto draw_random_word = [&](uint32_t draw_lane) -> uint64_t {
+        return generate_counter_based_word(session_configuration.session_seed, wheel_identifier, spin_number, draw_lane);
+    };
+    
+    vector<int> phase_indices(5);
+    size_t final_index = 0;
+    uint64_t spin_duration_steps = 0;
+    if (spin_wheel.sector_starts.empty()) {
+        for (uint32_t phase_offset = 0; phase_offset < phase_indices.size(); phase_offset++) {
+            phase_indices[phase_offset] = static_cast<int>(select_effective_draw_index(draw_model, draw_random_word(ROTATION_PHASE_LANE_BASE + phase_offset)));
+        }
+        final_index = select_effective_draw_index(draw_model, draw_random_word(FINAL_SELECTION_LANE));
+    } else {
+        physical_spin_state spin_state = launch_physical_spin(draw_random_word(FINAL_SELECTION_LANE));
+        spin_duration_steps = count_remaining_physical_steps(spin_state);
+        for (size_t phase_offset = 0; phase_offset < phase_indices.size(); phase_offset++) {
+            uint64_t target_step = spin_duration_steps * (phase_offset + 1) / 6;
+            while (spin_state.elapsed_steps < target_step && advance_physical_spin(spin_state)) {
+            }
+            phase_indices[phase_offset] = static_cast<int>(locate_physical_sector(spin_wheel, static_cast<uint32_t>(spin_state.wheel_angle)));
+        }
+        final_index = locate_physical_sector(spin_wheel, compute_stopping_angle(spin_state));
+    }
+    
+    append_rotation_clip(recording, choice_container, phase_indices, static_cast<int>(final_index), spin_duration_steps);
+    return final_index;
+}
+
+/*
+ * Replay clip function rendering one .cast per spin into the --record directory
+ * Clips are independent, so workers render and write them in parallel; clips.tsv lists
+ * every spin with its winner for audit lookups
+ */
+void execute_clip_recording(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: REPLAY CLIP RECORDING" << endl;
+    cout << "------------------------------" << endl;
+    
+    const string& directory_path = session_configuration.recording_path;
+    if (!create_output_directory(directory_path)) {
+        cout << "ERROR: Unable to create clip directory " << directory_path << endl;
+        return;
+    }
+    
+    physical_wheel spin_wheel;
+    if (session_configuration.physics_mode) {
+        build_physical_wheel(spin_wheel, option_weights.empty() ? vector<double>(choice_container.size(), 1.0) : option_weights);
+    }
+    effective_draw_model draw_model;
+    build_effective_draw_model(draw_model, choice_container, option_weights, nullptr, session_configuration);
+    
+    uint64_t clip_count = session_configuration.recording_clip_count;
+    vector<uint32_t> clip_winners(clip_count);
+    vector<double> clip_durations(clip_count);
+    atomic<uint64_t> failed_clip_count{0};
+    auto recording_start = chrono::steady_clock::now();
+    run_parallel_tasks(clip_count, max(1u, thread::hardware_concurrency()), [&](size_t clip_index) {
+        uint64_t spin_number = session_configuration.spin_number + clip_index;
+        spin_recording clip_recording;
+        clip_winners[clip_index] = static_cast<uint32_t>(render_counter_based_clip(choice_container, spin_wheel, draw_model, session_configuration,
+                                                                                  spin_number, clip_recording));
+        clip_durations[clip_index] = clip_recording.event_times.back();
+        string clip_path = directory_path + "/spin_" + to_string(spin_number) + ".cast";
+        if (!write_cast_recording(clip_recording, clip_path, "Decision wheel spin " + to_string(spin_number))) {
+            failed_clip_count.fetch_add(1);
+        }
+    });
+    double recording_seconds = chrono::duration<double>(chrono::steady_clock::now() - recording_start).count();
+    
+    ofstream index_stream(directory_path + "/clips.tsv", ios::binary);
+    double total_clip_seconds = 0.0;
+    for (uint64_t clip_index = 0; clip_index < clip_count; clip_index++) {
+        uint64_t spin_number = session_configuration.spin_number + clip_index;
+        index_stream << spin_number << "\t" << choice_container[clip_winners[clip_index]] << "\tspin_" << spin_number << ".cast\n";
+        total_clip_seconds += clip_durations[clip_index];
+    }
+    
+    cout << "Clips Written: " << clip_count - failed_clip_count.load() << " of " << clip_count << " (spins "
+         << session_configuration.spin_number << " to " << session_configuration.spin_number + clip_count - 1 << ") in " << directory_path << endl;
+    cout << "Outcome Model: " << (session_configuration.physics_mode ? "physical spin" : "counter-based draws") << endl;
+    cout << "Wall Time: " << fixed << setprecision(3) << recording_seconds << " s ("
+         << setprecision(0) << clip_count / max(recording_seconds, 1e-9) << " clips/s)" << endl;
+    cout << "Animation Time Recorded: " << setprecision(1) << total_clip_seconds << " s of real-time playback" << endl << endl;
+}
+
+/*
+ * Sector centre function returning the angle halfway through a sector
+ */
+uint32_t compute_sector_center_angle(const physical_wheel& spin_wheel, size_t sector_index) {
+    uint64_t sector_end = (sector_index + 1 < spin_wheel.sector_starts.size()) ? spin_wheel.sector_starts[sector_index + 1]
+                                                                               : PHYSICS_ANGLE_UNITS_PER_TURN;
+    return static_cast<uint32_t>(spin_wheel.sector_starts[sector_index] + (sector_end - spin_wheel.sector_starts[sector_index]) / 2);
+}
+
+/*
+ * Span fill function writing one colour over [span_start, span_end) of a pixel row
+ * RGB repeats every 3 bytes, so 16 pixels are prepared once as a 48-byte pattern and
+ * copied whole; fixed-size copies compile to three 16-byte vector stores per chunk
+ */
+void fill_raster_span(raster_image& image, int pixel_row, int span_start, int span_end, raster_color fill_color) {
+    if (pixel_row < 0 || pixel_row >= image.image_height) {
+        return;
+    }
+    span_start = max(span_start, 0);
+    span_end = min(span_end, image.image_width);
+    if (span_start >= span_end) {
+        return;
+    }
+    
+    uint8_t fill_pattern[RASTER_FILL_CHUNK_PIXELS * 3];
+    for (size_t pattern_pixel = 0; pattern_pixel < RASTER_FILL_CHUNK_PIXELS; pattern_pixel++) {
+        fill_pattern[3 * pattern_pixel] = fill_color.red;
+        fill_pattern[3 * pattern_pixel + 1] = fill_color.green;
+        fill_pattern[3 * pattern_pixel + 2] = fill_color.blue;
+    }
+    uint8_t* span_pixels = &image.rgb_pixels[(static_cast<size_t>(pixel_row) * image.image_width + span_start) * 3];
+    size_t pixel_count = static_cast<size_t>(span_end - span_start);
+    size_t full_chunks = pixel_count / RASTER_FILL_CHUNK_PIXELS;
+    for (size_t chunk_index = 0; chunk_index < full_chunks; chunk_index++) {
+        memcpy(span_pixels + chunk_index * sizeof(fill_pattern), fill_pattern, sizeof(fill_pattern));
+    }
+    memcpy(span_pixels + full_chunks * sizeof(fill_pattern), fill_pattern, (pixel_count % RASTER_FILL_CHUNK_PIXELS) * 3);
+}
+
+/*
+ * Text drawing function rendering upright labels with the built-in 5x7 font
+ * Glyphs advance 6 columns; each run of set bits becomes one scaled span per pixel row.
+ * UTF-8 continuation bytes are skipped so a multi-byte character draws a single box
+ */
+void draw_bitmap_text(raster_image& image, int center_x, int top_y, const string& text, int glyph_scale, raster_color text_color) {
+    size_t glyph_count = 0;
+    for (unsigned char text_byte : text) {
+        glyph_count += ((text_byte & 0xC0) != 0x80);
+    }
+    if (glyph_count == 0) {
+        return;
+    }
+    int pen_x = center_x - (static_cast<int>(glyph_count) * 6 * glyph_scale - glyph_scale) / 2;
+    
+    for (unsigned char text_byte : text) {
+        if ((text_byte & 0xC0) == 0x80) {
+            continue;
+        }
+        char glyph_character = static_cast<char>(toupper(text_byte));
+        const char* glyph_position = (glyph_character != '\0' && text_byte < 0x80) ? strchr(BITMAP_FONT_CHARACTERS, glyph_character) : nullptr;
+        const uint8_t* glyph_rows = glyph_position ? BITMAP_FONT_ROWS[glyph_position - BITMAP_FONT_CHARACTERS] : BITMAP_FONT_UNKNOWN_GLYPH;
+        
+        for (int glyph_row = 0; glyph_row < 7; glyph_row++) {
+            for (int run_start = 0; run_start < 5;) {
+                if (!((glyph_rows[glyph_row] >> (4 - run_start)) & 1)) {
+                    run_start++;
+                    continue;
+                }
+                int run_end = run_start;
+                while (run_end < 5 && ((glyph_rows[glyph_row] >> (4 - run_end)) & 1)) {
+                    run_end++;
+                }
+                for (int scaled_row = 0; scaled_row < glyph_scale; scaled_row++) {
+                    fill_raster_span(image, top_y + glyph_row * glyph_scale + scaled_row,
+                                     pen_x + run_start * glyph_scale, pen_x + run_end * glyph_scale, text_color);
+                }
+                run_start = run_end;
+            }
+        }
+        pen_x += 6 * glyph_scale;
+    }
+}
+
+/*
+ * Wheel rendering function rasterizing weighted sectors, labels, hub and pointer
+ * Angles grow clockwise from the pointer at 12 o'clock, which rests on pointer_angle.
+ * Along one pixel row the angle is monotonic, so each row starts from a single sector
+ * lookup and then only computes where the next boundary ray crosses it; every sector
+ * piece is one span fill. Cost is O(rows + boundary crossings), not O(pixels)
+ */
+void render_wheel_image(raster_image& image, const vector<string>& choice_container, const physical_wheel& spin_wheel,
+                        uint32_t pointer_angle, size_t selected_index) {
+    image.image_width = RASTER_IMAGE_WIDTH;
+    image.image_height = RASTER_IMAGE_HEIGHT;
+    image.rgb_pixels.resize(static_cast<size_t>(RASTER_IMAGE_WIDTH) * RASTER_IMAGE_HEIGHT * 3);
+    for (int pixel_row = 0; pixel_row < RASTER_IMAGE_HEIGHT; pixel_row++) {
+        fill_raster_span(image, pixel_row, 0, RASTER_IMAGE_WIDTH, RASTER_BACKGROUND_COLOR);
+    }
+    
+    const double full_turn_radians = 2.0 * acos(-1.0);
+    size_t sector_count = spin_wheel.sector_starts.size();
+    auto sector_color = [&](size_t sector_index) -> raster_color {
+        // The last sector borders sector 0, so it must not repeat sector 0's colour
+        size_t palette_index = sector_index % RASTER_PALETTE_SIZE;
+        if (sector_index > 0 && sector_index + 1 == sector_count && palette_index == 0) {
+            palette_index = RASTER_PALETTE_SIZE / 2;
+        }
+        return RASTER_SECTOR_PALETTE[palette_index];
+    };
+    auto screen_radians = [&](uint32_t wheel_angle) -> double {
+        return static_cast<uint32_t>(wheel_angle - pointer_angle) * (full_turn_radians / PHYSICS_ANGLE_UNITS_PER_TURN);
+    };
+    
+    const int center_x = RASTER_WHEEL_CENTER_X, center_y = RASTER_WHEEL_CENTER_Y;
+    const int inner_radius = RASTER_WHEEL_RADIUS - RASTER_RIM_WIDTH;
+    for (int pixel_row = center_y - RASTER_WHEEL_RADIUS; pixel_row < center_y + RASTER_WHEEL_RADIUS; pixel_row++) {
+        // Pixel centres sit at half-integers, so no row passes exactly through the centre
+        double offset_y = pixel_row + 0.5 - center_y;
+        double outer_half_width = sqrt(max(0.0, double(RASTER_WHEEL_RADIUS) * RASTER_WHEEL_RADIUS - offset_y * offset_y));
+        fill_raster_span(image, pixel_row, static_cast<int>(ceil(center_x - outer_half_width - 0.5)),
+                         static_cast<int>(floor(center_x + outer_half_width - 0.5)) + 1, RASTER_OUTLINE_COLOR);
+        if (fabs(offset_y) >= inner_radius) {
+            continue;
+        }
+        double inner_half_width = sqrt(double(inner_radius) * inner_radius - offset_y * offset_y);
+        int span_start = static_cast<int>(ceil(center_x - inner_half_width - 0.5));
+        int span_end = static_cast<int>(floor(center_x + inner_half_width - 0.5)) + 1;
+        if (span_start >= span_end) {
+            continue;
+        }
+        
+        auto pixel_wheel_angle = [&](int pixel_column) -> uint32_t {
+            double pointer_turns = atan2(pixel_column + 0.5 - center_x, -offset_y) / full_turn_radians;
+            pointer_turns += (pointer_turns < 0.0) ? 1.0 : 0.0;
+            return pointer_angle + static_cast<uint32_t>(min<double>(pointer_turns * PHYSICS_ANGLE_UNITS_PER_TURN, PHYSICS_ANGLE_UNITS_PER_TURN - 1));
+        };
+        uint32_t first_angle = pixel_wheel_angle(span_start);
+        uint32_t last_angle = pixel_wheel_angle(span_end - 1);
+        
+        // Above the centre angles grow left to right, below it they shrink; either way a
+        // row covers less than half a turn, so each boundary is crossed at most once
+        bool increasing_row = offset_y < 0.0;
+        uint32_t row_angle_range = increasing_row ? last_angle - first_angle : first_angle - last_angle;
+        size_t current_sector = locate_physical_sector(spin_wheel, first_angle);
+        int pixel_column = span_start;
+        for (size_t crossed_boundaries = 0; pixel_column < span_end; crossed_boundaries++) {
+            size_t next_sector = increasing_row ? (current_sector + 1) % sector_count : (current_sector + sector_count - 1) % sector_count;
+            uint32_t boundary_angle = spin_wheel.sector_starts[increasing_row ? next_sector : current_sector];
+            uint32_t boundary_distance = increasing_row ? boundary_angle - first_angle : first_angle - boundary_angle;
+            if (crossed_boundaries >= sector_count || boundary_distance > row_angle_range) {
+                fill_raster_span(image, pixel_row, pixel_column, span_end, sector_color(current_sector));
+                break;
+            }
+            
+            // The boundary ray (sin, -cos) meets this row at x = centre - offset_y * tan(angle)
+            double crossing_x = center_x - offset_y * tan(screen_radians(boundary_angle));
+            int boundary_column = increasing_row ? static_cast<int>(ceil(crossing_x - 0.5)) : static_cast<int>(floor(crossing_x - 0.5)) + 1;
+            boundary_column = min(max(boundary_column, pixel_column), span_end);
+            fill_raster_span(image, pixel_row, pixel_column, boundary_column, sector_color(current_sector));
+            pixel_column = boundary_column;
+            current_sector = next_sector;
+        }
+    }
+    
+    // Hub over the centre
+    for (int pixel_row = center_y - RASTER_HUB_RADIUS; pixel_row < center_y + RASTER_HUB_RADIUS; pixel_row++) {
+        double offset_y = pixel_row + 0.5 - center_y;
+        double hub_half_width = sqrt(max(0.0, double(RASTER_HUB_RADIUS) * RASTER_HUB_RADIUS - offset_y * offset_y));
+        fill_raster_span(image, pixel_row, static_cast<int>(ceil(center_x - hub_half_width - 0.5)),
+                         static_cast<int>(floor(center_x + hub_half_width - 0.5)) + 1, RASTER_OUTLINE_COLOR);
+    }
+    
+    // Labels at 62% of the radius for sectors of at least 12 degrees, truncated to the room available
+    const double label_radius = 0.62 * inner_radius;
+    for (size_t sector_index = 0; sector_index < sector_count; sector_index++) {
+        uint64_t sector_end = (sector_index + 1 < sector_count) ? spin_wheel.sector_starts[sector_index + 1] : PHYSICS_ANGLE_UNITS_PER_TURN;
+        uint64_t sector_width = sector_end - spin_wheel.sector_starts[sector_index];
+        if (sector_width < PHYSICS_ANGLE_UNITS_PER_TURN / 30) {
+            continue;
+        }
+        double width_radians = sector_width * (full_turn_radians / PHYSICS_ANGLE_UNITS_PER_TURN);
+        double label_room = (width_radians < full_turn_radians / 2) ? min(2.0 * label_radius * sin(width_radians / 2), 0.7 * inner_radius)
+                                                                    : 0.7 * inner_radius;
+        int glyph_scale = (label_room >= 3 * 12) ? 2 : 1;
+        size_t glyph_capacity = static_cast<size_t>((label_room + glyph_scale) / (6 * glyph_scale));
+        if (glyph_capacity < 2) {
+            continue;
+        }
+        string sector_label = choice_container[sector_index];
+        if (sector_label.size() > glyph_capacity) {
+            sector_label = sector_label.substr(0, glyph_capacity - 1) + ".";
+        }
+        double label_angle = screen_radians(compute_sector_center_angle(spin_wheel, sector_index));
+        draw_bitmap_text(image, static_cast<int>(lround(center_x + label_radius * sin(label_angle))),
+                         static_cast<int>(lround(center_y - label_radius * cos(label_angle) - 3.5 * glyph_scale)),
+                         sector_label, glyph_scale, RASTER_TEXT_COLOR);
+    }
+    
+    // Pointer: a downward triangle biting into the rim at 12 o'clock
+    const int pointer_tip_y = center_y - RASTER_WHEEL_RADIUS + 16;
+    const int pointer_base_y = center_y - RASTER_WHEEL_RADIUS - 20;
+    const double pointer_half_base = 15.0;
+    for (int pixel_row = pointer_base_y; pixel_row < pointer_tip_y; pixel_row++) {
+        double pointer_half_width = pointer_half_base * (pointer_tip_y - (pixel_row + 0.5)) / (pointer_tip_y - pointer_base_y);
+        fill_raster_span(image, pixel_row, static_cast<int>(ceil(center_x - pointer_half_width - 0.5)),
+                         static_cast<int>(floor(center_x + pointer_half_width - 0.5)) + 1, RASTER_POINTER_COLOR);
+    }
+    
+    // Caption naming the winner below the wheel
+    string caption_text = "SELECTED: " + choice_container[selected_index];
+    size_t caption_capacity = static_cast<size_t>((RASTER_IMAGE_WIDTH - 24) / 12);
+    if (caption_text.size() > caption_capacity) {
+        caption_text = caption_text.substr(0, caption_capacity - 1) + ".";
+    }
+    draw_bitmap_text(image, center_x, RASTER_IMAGE_HEIGHT - 52, caption_text, 2, RASTER_TEXT_COLOR);
+}
+
+/*
+ * QOI encoder function (Quite OK Image format, 2021 specification) for RGB images
+ * Flat sector fills turn into long runs, so wheel images compress to a few kilobytes.
+ * Output goes through a raw cursor into a buffer that only ever grows to the worst case,
+ * so reused buffers are never cleared; the encoded length is returned. Runs are measured
+ * by a tight scan before any chunk is emitted
+ */
+size_t encode_qoi_image(const raster_image& image, vector<uint8_t>& encoded_buffer) {
+    size_t pixel_count = static_cast<size_t>(image.image_width) * image.image_height;
+    if (encoded_buffer.size() < 14 + pixel_count * 4 + 8) {
+        encoded_buffer.resize(14 + pixel_count * 4 + 8);
+    }
+    uint8_t* output_cursor = encoded_buffer.data();
+    auto append_big_endian = [&](uint32_t header_value) {
+        for (int byte_shift = 24; byte_shift >= 0; byte_shift -= 8) {
+            *output_cursor++ = static_cast<uint8_t>(header_value >> byte_shift);
+        }
+    };
+    memcpy(output_cursor, "qoif", 4);
+    output_cursor += 4;
+    append_big_endian(static_cast<uint32_t>(image.image_width));
+    append_big_endian(static_cast<uint32_t>(image.image_height));
+    *output_cursor++ = 3;       // RGB channels
+    *output_cursor++ = 0;       // sRGB with linear alpha
+    
+    // Alpha is always 255, so only RGB is compared; index slots start as (0,0,0,0)
+    array<array<uint8_t, 3>, 64> seen_pixels{};
+    array<bool, 64> seen_slot_used{};
+    const uint8_t* pixel_bytes = image.rgb_pixels.data();
+    uint8_t previous_red = 0, previous_green = 0, previous_blue = 0;
+    
+    for (size_t pixel_index = 0; pixel_index < pixel_count;) {
+        // Runs of the previous colour are emitted in chunks of at most 62 (QOI_OP_RUN)
+        size_t run_end = pixel_index;
+        while (run_end < pixel_count && pixel_bytes[3 * run_end] == previous_red &&
+               pixel_bytes[3 * run_end + 1] == previous_green && pixel_bytes[3 * run_end + 2] == previous_blue) {
+            run_end++;
+        }
+        for (size_t run_length = run_end - pixel_index; run_length > 0;) {
+            size_t chunk_length = min<size_t>(run_length, 62);
+            *output_cursor++ = static_cast<uint8_t>(0xC0 | (chunk_length - 1));
+            run_length -= chunk_length;
+        }
+        pixel_index = run_end;
+        if (pixel_index == pixel_count) {
+            break;
+        }
+        
+        uint8_t pixel_red = pixel_bytes[3 * pixel_index];
+        uint8_t pixel_green = pixel_bytes[3 * pixel_index + 1];
+        uint8_t pixel_blue = pixel_bytes[3 * pixel_index + 2];
+        size_t hash_slot = (pixel_red * 3 + pixel_green * 5 + pixel_blue * 7 + 255 * 11) % 64;
+        if (seen_slot_used[hash_slot] && seen_pixels[hash_slot][0] == pixel_red &&
+            seen_pixels[hash_slot][1] == pixel_green && seen_pixels[hash_slot][2] == pixel_blue) {
+            *output_cursor++ = static_cast<uint8_t>(hash_slot);                         // QOI_OP_INDEX
+        } else {
+            seen_slot_used[hash_slot] = true;
+            seen_pixels[hash_slot] = {pixel_red, pixel_green, pixel_blue};
+            int red_delta = static_cast<int8_t>(pixel_red - previous_red);
+            int green_delta = static_cast<int8_t>(pixel_green - previous_green);
+            int blue_delta = static_cast<int8_t>(pixel_blue - previous_blue);
+            int red_from_green = red_delta - green_delta, blue_from_green = blue_delta - green_delta;
+            if (red_delta >= -2 && red_delta <= 1 && green_delta >= -2 && green_delta <= 1 && blue_delta >= -2 && blue_delta <= 1) {
+                *output_cursor++ = static_cast<uint8_t>(0x40 | ((red_delta + 2) << 4) | ((green_delta + 2) << 2) | (blue_delta + 2));   // QOI_OP_DIFF
+            } else if (green_delta >= -32 && green_delta <= 31 && red_from_green >= -8 && red_from_green <= 7 &&
+                       blue_from_green >= -8 && blue_from_green <= 7) {
+                *output_cursor++ = static_cast<uint8_t>(0x80 | (green_delta + 32));                                               // QOI_OP_LUMA
+                *output_cursor++ = static_cast<uint8_t>(((red_from_green + 8) << 4) | (blue_from_green + 8));
+            } else {
+                *output_cursor++ = 0xFE;                                                                                          // QOI_OP_RGB
+                *output_cursor++ = pixel_red;
+                *output_cursor++ = pixel_green;
+                *output_cursor++ = pixel_blue;
+            }
+        }
+        previous_red = pixel_red;
+        previous_green = pixel_green;
+        previous_blue = pixel_blue;
+        pixel_index++;
+    }
+    memcpy(output_cursor, "\0\0\0\0\0\0\0\1", 8);
+    output_cursor += 8;
+    return static_cast<size_t>(output_cursor - encoded_buffer.data());
+}
+
+/*
+ * Image writer function: paths ending in .qoi are QOI-encoded, anything else binary PPM
+ */
+bool write_raster_image(const raster_image& image, const string& output_path) {
+    const string qoi_suffix = ".qoi";
+    vector<uint8_t> encoded_buffer;
+    size_t encoded_length = 0;
+    if (output_path.size() >= qoi_suffix.size() &&
+        output_path.compare(output_path.size() - qoi_suffix.size(), qoi_suffix.size(), qoi_suffix) == 0) {
+        encoded_length = encode_qoi_image(image, encoded_buffer);
+    } else {
+        string ppm_header = "P6\n" + to_string(image.image_width) + " " + to_string(image.image_height) + "\n255\n";
+        encoded_buffer.assign(ppm_header.begin(), ppm_header.end());
+        encoded_buffer.insert(encoded_buffer.end(), image.rgb_pixels.begin(), image.rgb_pixels.end());
+        encoded_length = encoded_buffer.size();
+    }
+    
+    ofstream output_stream(output_path, ios::binary);
+    if (!output_stream.write(reinterpret_cast<const char*>(encoded_buffer.data()), static_cast<streamsize>(encoded_length))) {
+        cout << "ERROR: Unable to write image " << output_path << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Batch image function rendering one QOI wheel image per spin into the --render directory
+ * Each image is a pure function of its spin, so workers render and encode in parallel
+ * with per-thread buffers that are reused across images
+ */
+void execute_image_rendering(const vector<string>& choice_container, const vector<double>& option_weights, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: WHEEL IMAGE RENDERING" << endl;
+    cout << "------------------------------" << endl;
+    
+    const string& directory_path = session_configuration.render_path;
+    if (!create_output_directory(directory_path)) {
+        cout << "ERROR: Unable to create image directory " << directory_path << endl;
+        return;
+    }
+    
+    effective_draw_model draw_model;
+    build_effective_draw_model(draw_model, choice_container, option_weights, nullptr, session_configuration);
+    physical_wheel image_wheel;
+    build_physical_wheel(image_wheel, draw_model.option_probabilities);
+    uint64_t wheel_identifier = compute_wheel_identifier(choice_container);
+    uint64_t image_count = session_configuration.render_image_count;
+    atomic<uint64_t> written_image_count{0}, written_byte_count{0};
+    
+    auto rendering_start = chrono::steady_clock::now();
+    run_parallel_tasks(image_count, max(1u, thread::hardware_concurrency()), [&](size_t image_index) {
+        uint64_t spin_number = session_configuration.spin_number + image_index;
+        uint64_t random_word = generate_counter_based_word(session_configuration.session_seed, wheel_identifier, spin_number, FINAL_SELECTION_LANE);
+        
+        // Same outcome as the live spin: physical rest angle, or the centre of the drawn sector
+        uint32_t pointer_angle;
+        size_t selected_index;
+        if (session_configuration.physics_mode) {
+            pointer_angle = compute_stopping_angle(launch_physical_spin(random_word));
+            selected_index = locate_physical_sector(image_wheel, pointer_angle);
+        } else {
+            selected_index = select_effective_draw_index(draw_model, random_word);
+            pointer_angle = compute_sector_center_angle(image_wheel, selected_index);
+        }
+        
+        thread_local raster_image wheel_image;
+        thread_local vector<uint8_t> encoded_buffer;
+        render_wheel_image(wheel_image, choice_container, image_wheel, pointer_angle, selected_index);
+        size_t encoded_length = encode_qoi_image(wheel_image, encoded_buffer);
+        ofstream image_stream(directory_path + "/spin_" + to_string(spin_number) + ".qoi", ios::binary);
+        if (image_stream.write(reinterpret_cast<const char*>(encoded_buffer.data()), static_cast<streamsize>(encoded_length))) {
+            written_image_count.fetch_add(1);
+            written_byte_count.fetch_add(encoded_length);
+        }
+    });
+    double rendering_seconds = chrono::duration<double>(chrono::steady_clock::now() - rendering_start).count();
+    
+    cout << "Images Written: " << written_image_count.load() << " of " << image_count << " (spins "
+         << session_configuration.spin_number << " to " << session_configuration.spin_number + image_count - 1 << ") in " << directory_path << endl;
+    cout << "Image Format: " << RASTER_IMAGE_WIDTH << "x" << RASTER_IMAGE_HEIGHT << " QOI, "
+         << written_byte_count.load() / max<uint64_t>(1, written_image_count.load()) << " bytes on average" << endl;
+    cout << "Wall Time: " << fixed << setprecision(3) << rendering_seconds << " s ("
+         << setprecision(0) << image_count / max(rendering_seconds, 1e-9) << " images/s)" << endl << endl;
+}
+
+/*
+ * Wheel compilation function implementing prefix-sum table construction
+ * Runs in O(n) after every edit so subsequent spins only perform a binary search
+ */
+void compile_wheel(compiled_wheel& wheel) {
+    wheel.option_weights.resize(wheel.choice_container.size(), 1.0);
+    wheel.cumulative_weights.resize(wheel.option_weights.size());
+    
+    double running_total = 0.0;
+    for (size_t option_index = 0; option_index < wheel.option_weights.size(); option_index++) {
+        running_total += wheel.option_weights[option_index];
+        wheel.cumulative_weights[option_index] = running_total;
+    }
+    
+    wheel.total_weight = running_total;
+    wheel.wheel_identifier = compute_wheel_identifier(wheel.choice_container);
+    
+    // Keyed assignment identifies options by label so reordering never moves keys
+    wheel.option_key_seeds.resize(wheel.choice_container.size());
+    for (size_t option_index = 0; option_index < wheel.choice_container.size(); option_index++) {
+        const string& option_label = wheel.choice_container[option_index];
+        wheel.option_key_seeds[option_index] = hash_selection_key(option_label.data(), option_label.size(), 0);
+    }
+    
+    // Small wheels switch to the inline table; anything larger keeps the prefix sums
+    wheel.uses_small_wheel = build_small_wheel(wheel.choice_container, wheel.option_weights, wheel.inline_table);
+}
+
+/*
+ * Small wheel construction function implementing quantized interval table setup
+ * Returns false when the wheel exceeds the inline capacity so callers fall back
+ */
+bool build_small_wheel(const vector<string>& choice_container, const vector<double>& option_weights, small_wheel& inline_wheel) {
+    if (choice_container.size() > SMALL_WHEEL_CAPACITY || choice_container.size() != option_weights.size()) {
+        return false;
+    }
+    
+    double total_weight = 0.0;
+    size_t label_byte_count = 0;
+    for (size_t option_index = 0; option_index < choice_container.size(); option_index++) {
+        label_byte_count += choice_container[option_index].size();
+        total_weight += option_weights[option_index];
+    }
+    if (label_byte_count > SMALL_WHEEL_LABEL_BYTES) {
+        return false;
+    }
+    if (total_weight <= 0.0) {
+        return false;
+    }
+    
+    // Interval starts are cumulative probabilities scaled to 2^31; unused slots sit at 2^31
+    double running_weight = 0.0;
+    size_t label_offset = 0;
+    for (size_t slot_index = 0; slot_index < SMALL_WHEEL_CAPACITY; slot_index++) {
+        inline_wheel.label_offsets[slot_index] = static_cast<uint16_t>(label_offset);
+        if (slot_index < choice_container.size()) {
+            double start_fraction = min(1.0, running_weight / total_weight);
+            inline_wheel.interval_starts[slot_index] = static_cast<uint32_t>(start_fraction * SMALL_WHEEL_THRESHOLD_SCALE);
+            memcpy(inline_wheel.label_bytes + label_offset, choice_container[slot_index].data(), choice_container[slot_index].size());
+            label_offset += choice_container[slot_index].size();
+            running_weight += option_weights[slot_index];
+        } else {
+            inline_wheel.interval_starts[slot_index] = SMALL_WHEEL_THRESHOLD_SCALE;
+        }
+    }
+    inline_wheel.label_offsets[SMALL_WHEEL_CAPACITY] = static_cast<uint16_t>(label_offset);
+    inline_wheel.option_count = static_cast<uint8_t>(choice_container.size());
+    return true;
+}
+
+/*
+ * Small wheel selection function implementing a branch-free 16-lane comparison
+ * The winner is the last interval whose start does not exceed the 31-bit draw
+ */
+size_t select_small_wheel_index(const small_wheel& inline_wheel, uint64_t random_word) {
+    uint32_t draw_value = static_cast<uint32_t>(random_word >> 33);
+    size_t covered_intervals = 0;
+    
+    for (size_t slot_index = 0; slot_index < SMALL_WHEEL_CAPACITY; slot_index++) {
+        covered_intervals += (draw_value >= inline_wheel.interval_starts[slot_index]);
+    }
+    return covered_intervals - 1;
+}
+
+/*
+ * Label lookup function returning an option label from the wheel's compact form
+ * Small wheels answer from their packed label bytes; larger wheels use the option list
+ */
+string read_compiled_wheel_label(const compiled_wheel& wheel, size_t option_index) {
+    if (wheel.uses_small_wheel) {
+        const small_wheel& inline_wheel = wheel.inline_table;
+        return string(inline_wheel.label_bytes + inline_wheel.label_offsets[option_index],
+                      inline_wheel.label_offsets[option_index + 1] - inline_wheel.label_offsets[option_index]);
+    }
+    return wheel.choice_container[option_index];
+}
+
+/*
+ * Weighted selection function mapping a random word onto the compiled prefix sums
+ */
+size_t select_compiled_wheel_index(const compiled_wheel& wheel, uint64_t random_word) {
+    if (wheel.uses_small_wheel) {
+        return select_small_wheel_index(wheel.inline_table, random_word);
+    }
+    
+    // Top 53 bits form a uniform double in [0, 1) scaled to the total weight
+    double target_weight = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0) * wheel.total_weight;
+    size_t selected_index = upper_bound(wheel.cumulative_weights.begin(), wheel.cumulative_weights.end(), target_weight)
+                            - wheel.cumulative_weights.begin();
+    return min(selected_index, wheel.cumulative_weights.size() - 1);
+}
+
+/*
+ * Folded multiplication function returning (low ^ high) of the 128-bit product
+ * This is the wyhash "mum" primitive, computed portably from 32-bit partial products
+ */
+uint64_t multiply_and_fold(uint64_t first_operand, uint64_t second_operand) {
+    uint64_t high_product = map_random_word_to_index(first_operand, second_operand);
+    uint64_t low_product = first_operand * second_operand;
+    return high_product ^ low_product;
+}
+
+/*
+ * Key hashing function implementing a wyhash-style 64-bit non-cryptographic hash
+ * Eight-byte blocks are mixed pairwise with the folded multiply for high throughput
+ */
+uint64_t hash_selection_key(const char* key_data, size_t key_length, uint64_t hash_seed) {
+    const uint64_t secret_words[4] = {0xA0761D6478BD642FULL, 0xE7037ED1A0B428DBULL,
+                                      0x8EBC6AF09C88C6E3ULL, 0x589965CC75374CC3ULL};
+    auto read_block = [key_data](size_t byte_offset, size_t byte_count) -> uint64_t {
+        uint64_t block_value = 0;
+        memcpy(&block_value, key_data + byte_offset, byte_count);
+        return block_value;
+    };
+    
+    uint64_t hash_state = hash_seed ^ multiply_and_fold(hash_seed ^ secret_words[0], secret_words[1]);
+    size_t byte_offset = 0;
+    
+    // Bulk phase: 16 bytes per step
+    while (key_length - byte_offset > 16) {
+        hash_state = multiply_and_fold(read_block(byte_offset, 8) ^ secret_words[1],
+                                       read_block(byte_offset + 8, 8) ^ hash_state);
+        byte_offset += 16;
+    }
+    
+    // Tail phase: the remaining 1-16 bytes are packed into two words
+    size_t tail_length = key_length - byte_offset;
+    uint64_t first_word = read_block(byte_offset, min<size_t>(tail_length, 8));
+    uint64_t second_word = (tail_length > 8) ? read_block(byte_offset + 8, tail_length - 8) : 0;
+    
+    hash_state = multiply_and_fold(first_word ^ secret_words[1], second_word ^ hash_state);
+    return multiply_and_fold(secret_words[0] ^ key_length, hash_state ^ secret_words[1]);
+}
+
+/*
+ * Keyed selection function implementing weighted rendezvous (highest random weight) hashing
+ * Option i scores w_i / -ln(u_i) with u_i derived from (key, option label); the best score wins.
+ * Changing one weight only moves keys to or from that option
+ */
+size_t select_keyed_wheel_index(const compiled_wheel& wheel, uint64_t key_hash) {
+    size_t best_index = 0;
+    double best_score = -1.0;
+    
+    for (size_t option_index = 0; option_index < wheel.option_weights.size(); option_index++) {
+        double option_weight = wheel.option_weights[option_index];
+        if (option_weight <= 0.0) {
+            continue;
+        }
+        
+        // Map the combined hash to the open interval (0, 1) before taking the logarithm
+        uint64_t combined_hash = multiply_and_fold(key_hash ^ wheel.option_key_seeds[option_index], 0x9FB21C651E98DF25ULL);
+        double unit_value = (static_cast<double>(combined_hash >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        double option_score = option_weight / -log(unit_value);
+        
+        if (option_score > best_score) {
+            best_score = option_score;
+            best_index = option_index;
+        }
+    }
+    return best_index;
+}
+
+/*
+ * Batch keyed assignment function mapping many keys onto the wheel in one pass
+ */
+void assign_keys_to_options(const compiled_wheel& wheel, const vector<string>& selection_keys, vector<uint32_t>& assigned_indices) {
+    assigned_indices.resize(selection_keys.size());
+    for (size_t key_index = 0; key_index < selection_keys.size(); key_index++) {
+        const string& selection_key = selection_keys[key_index];
+        uint64_t key_hash = hash_selection_key(selection_key.data(), selection_key.size(), 0);
+        assigned_indices[key_index] = static_cast<uint32_t>(select_keyed_wheel_index(wheel, key_hash));
+    }
+}
+
+/*
+ * Fenwick construction function building a one-based binary indexed tree in O(n)
+ */
+void build_fenwick_tree(vector<double>& fenwick_tree, const vector<double>& option_values) {
+    size_t option_count = option_values.size();
+    fenwick_tree.assign(option_count + 1, 0.0);
+    for (size_t option_index = 0; option_index < option_count; option_index++) {
+        fenwick_tree[option_index + 1] = option_values[option_index];
+    }
+    
+    // Propagate each node into its parent to complete the tree in linear time
+    for (size_t tree_index = 1; tree_index <= option_count; tree_index++) {
+        size_t parent_index = tree_index + (tree_index & (~tree_index + 1));
+        if (parent_index <= option_count) {
+            fenwick_tree[parent_index] += fenwick_tree[tree_index];
+        }
+    }
+}
+
+/*
+ * Fenwick update function adding a delta to one option in O(log n)
+ */
+void add_fenwick_value(vector<double>& fenwick_tree, size_t option_index, double value_delta) {
+    for (size_t tree_index = option_index + 1; tree_index < fenwick_tree.size(); tree_index += tree_index & (~tree_index + 1)) {
+        fenwick_tree[tree_index] += value_delta;
+    }
+}
+
+/*
+ * Fenwick search function returning the option whose prefix interval contains the target
+ * Descends from the highest power of two, skipping subtrees whose mass lies below the target
+ */
+size_t find_fenwick_index(const vector<double>& fenwick_tree, double target_value) {
+    size_t option_count = fenwick_tree.size() - 1;
+    size_t descent_position = 0;
+    size_t step_size = 1;
+    while (step_size * 2 <= option_count) {
+        step_size *= 2;
+    }
+    for (; step_size > 0; step_size /= 2) {
+        size_t probe_position = descent_position + step_size;
+        if (probe_position <= option_count && fenwick_tree[probe_position] <= target_value) {
+            descent_position = probe_position;
+            target_value -= fenwick_tree[probe_position];
+        }
+    }
+    return min(descent_position, option_count - 1);
+}
+
+/*
+ * Cooldown initialization function resetting weights and the exclusion history
+ * The window is capped so that at least one positive-weight option stays eligible
+ */
+void initialize_cooldown_sampler(cooldown_sampler& sampler, const vector<double>& option_weights, size_t cooldown_length) {
+    sampler.base_weights = option_weights;
+    sampler.recent_winners.clear();
+    sampler.exclusion_flags.assign(option_weights.size(), 0);
+    
+    size_t eligible_options = count_if(option_weights.begin(), option_weights.end(), [](double weight) { return weight > 0.0; });
+    sampler.cooldown_length = min(cooldown_length, eligible_options > 0 ? eligible_options - 1 : 0);
+    rebuild_cooldown_tree(sampler);
+}
+
+/*
+ * Fenwick rebuild function implementing O(n) construction from the active weights
+ */
+void rebuild_cooldown_tree(cooldown_sampler& sampler) {
+    vector<double> active_weights(sampler.base_weights.size(), 0.0);
+    sampler.active_total = 0.0;
+    
+    for (size_t option_index = 0; option_index < active_weights.size(); option_index++) {
+        if (!sampler.exclusion_flags[option_index]) {
+            active_weights[option_index] = sampler.base_weights[option_index];
+            sampler.active_total += sampler.base_weights[option_index];
+        }
+    }
+    build_fenwick_tree(sampler.fenwick_tree, active_weights);
+    sampler.updates_since_rebuild = 0;
+}
+
+/*
+ * Cooldown weight function adjusting one option's eligible weight in O(log n)
+ */
+void adjust_cooldown_weight(cooldown_sampler& sampler, size_t option_index, double weight_delta) {
+    add_fenwick_value(sampler.fenwick_tree, option_index, weight_delta);
+    sampler.active_total += weight_delta;
+    sampler.updates_since_rebuild++;
+}
+
+/*
+ * Cooldown selection function implementing Fenwick descent over eligible weights
+ * The winner is excluded for the next cooldown_length spins, then restored.
+ * If no eligible option has positive weight the draw falls back to a uniform pick
+ * among the options that are not cooling down
+ */
+size_t draw_cooldown_index(cooldown_sampler& sampler, uint64_t random_word) {
+    size_t option_count = sampler.base_weights.size();
+    size_t selected_index = option_count;
+    if (sampler.active_total > 0.0) {
+        double target_weight = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0) * sampler.active_total;
+        size_t candidate_index = find_fenwick_index(sampler.fenwick_tree, target_weight);
+        
+        // Floating-point residue can land on an excluded or zero-weight slot; step back to an eligible one,
+        // at most once around the wheel in case the total is residue alone
+        for (size_t stepped_options = 0; stepped_options < option_count; stepped_options++) {
+            if (sampler.base_weights[candidate_index] > 0.0 && !sampler.exclusion_flags[candidate_index]) {
+                selected_index = candidate_index;
+                break;
+            }
+            candidate_index = (candidate_index + option_count - 1) % option_count;
+        }
+    }
+    
+    if (selected_index == option_count) {
+        vector<size_t> eligible_options;
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            if (!sampler.exclusion_flags[option_index]) {
+                eligible_options.push_back(option_index);
+            }
+        }
+        selected_index = eligible_options.empty()
+            ? static_cast<size_t>(map_random_word_to_index(random_word, option_count))
+            : eligible_options[map_random_word_to_index(random_word, eligible_options.size())];
+    }
+    
+    if (sampler.cooldown_length > 0) {
+        adjust_cooldown_weight(sampler, selected_index, -sampler.base_weights[selected_index]);
+        sampler.recent_winners.push_back(selected_index);
+        sampler.exclusion_flags[selected_index] = 1;
+        
+        if (sampler.recent_winners.size() > sampler.cooldown_length) {
+            size_t released_index = sampler.recent_winners.front();
+            sampler.recent_winners.pop_front();
+            sampler.exclusion_flags[released_index] = 0;
+            adjust_cooldown_weight(sampler, released_index, sampler.base_weights[released_index]);
+        }
+        if (sampler.updates_since_rebuild >= COOLDOWN_REBUILD_INTERVAL) {
+            rebuild_cooldown_tree(sampler);
+        }
+    }
+    return selected_index;
+}
+
+/*
+ * Decaying wheel initialization function with empty boosts and a fresh epoch
+ */
+void initialize_decaying_wheel(decaying_wheel& wheel, const vector<double>& base_weights, double half_life_seconds, double start_time) {
+    wheel.base_weights = base_weights;
+    build_fenwick_tree(wheel.base_tree, wheel.base_weights);
+    wheel.base_total = 0.0;
+    for (double base_weight : base_weights) {
+        wheel.base_total += base_weight;
+    }
+    
+    wheel.stored_boosts.assign(base_weights.size(), 0.0);
+    build_fenwick_tree(wheel.boost_tree, wheel.stored_boosts);
+    wheel.stored_boost_total = 0.0;
+    wheel.decay_rate = (half_life_seconds > 0.0) ? log(2.0) / half_life_seconds : 0.0;
+    wheel.epoch_time = start_time;
+    wheel.current_time = start_time;
+}
+
+/*
+ * Clock advance function implementing O(1) decay for every option at once
+ * Only when the epoch scale would overflow are stored boosts rescaled, an O(n) pass
+ * that happens once per ~60 half-lives
+ */
+void advance_decaying_wheel(decaying_wheel& wheel, double elapsed_seconds) {
+    wheel.current_time += max(0.0, elapsed_seconds);
+    
+    double epoch_scale = exp(wheel.decay_rate * (wheel.current_time - wheel.epoch_time));
+    if (epoch_scale < DECAY_RENORMALIZATION_BOUND) {
+        return;
+    }
+    wheel.stored_boost_total = 0.0;
+    for (double& stored_boost : wheel.stored_boosts) {
+        stored_boost /= epoch_scale;
+        wheel.stored_boost_total += stored_boost;
+    }
+    build_fenwick_tree(wheel.boost_tree, wheel.stored_boosts);
+    wheel.epoch_time = wheel.current_time;
+}
+
+/*
+ * Boost function adding a decaying weight increment to one option in O(log n)
+ */
+void boost_decaying_option(decaying_wheel& wheel, size_t option_index, double boost_amount) {
+    double stored_amount = boost_amount * exp(wheel.decay_rate * (wheel.current_time - wheel.epoch_time));
+    wheel.stored_boosts[option_index] += stored_amount;
+    wheel.stored_boost_total += stored_amount;
+    add_fenwick_value(wheel.boost_tree, option_index, stored_amount);
+}
+
+/*
+ * Base weight function replacing one option's non-decaying weight in O(log n)
+ */
+void set_decaying_base_weight(decaying_wheel& wheel, size_t option_index, double base_weight) {
+    double weight_delta = base_weight - wheel.base_weights[option_index];
+    wheel.base_weights[option_index] = base_weight;
+    wheel.base_total += weight_delta;
+    add_fenwick_value(wheel.base_tree, option_index, weight_delta);
+}
+
+/*
+ * Boost query function returning an option's remaining boost at the current time
+ */
+double decayed_boost_value(const decaying_wheel& wheel, size_t option_index) {
+    return wheel.stored_boosts[option_index] * exp(-wheel.decay_rate * (wheel.current_time - wheel.epoch_time));
+}
+
+/*
+ * Decay factor function converting epoch-scaled stored boosts into boosts at the current time
+ */
+double compute_decay_factor(const decaying_wheel& wheel) {
+    return exp(-wheel.decay_rate * (wheel.current_time - wheel.epoch_time));
+}
+
+/*
+ * Decaying selection function sampling base + decayed boost weights in O(log n)
+ * The high bits choose the tree by mass, the rest of the word locates the option within it
+ */
+size_t select_decaying_index(const decaying_wheel& wheel, uint64_t random_word) {
+    double boost_total = wheel.stored_boost_total * exp(-wheel.decay_rate * (wheel.current_time - wheel.epoch_time));
+    double target_weight = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0) * (wheel.base_total + boost_total);
+    
+    if (target_weight < wheel.base_total || boost_total <= 0.0) {
+        return find_fenwick_index(wheel.base_tree, min(target_weight, wheel.base_total));
+    }
+    
+    // Convert the remaining mass back into epoch-scaled units for the boost tree
+    double stored_target = (target_weight - wheel.base_total) / boost_total * wheel.stored_boost_total;
+    return find_fenwick_index(wheel.boost_tree, stored_target);
+}
+
+/*
+ * Bitmap append function adding option indices in non-decreasing order
+ */
+void append_bitmap_value(compressed_bitmap& bitmap, uint32_t option_value) {
+    uint16_t high_key = static_cast<uint16_t>(option_value >> 16);
+    uint16_t low_value = static_cast<uint16_t>(option_value & 0xFFFF);
+    
+    if (bitmap.containers.empty() || bitmap.containers.back().high_key != high_key) {
+        bitmap.containers.emplace_back();
+        bitmap.containers.back().high_key = high_key;
+    }
+    bitmap_container& container = bitmap.containers.back();
+    
+    if (container.bitset_words.empty()) {
+        if (!container.sorted_values.empty() && container.sorted_values.back() == low_value) {
+            return;
+        }
+        container.sorted_values.push_back(low_value);
+        container.cardinality++;
+        normalize_bitmap_container(container);
+    } else if (!(container.bitset_words[low_value >> 6] >> (low_value & 63) & 1)) {
+        container.bitset_words[low_value >> 6] |= 1ULL << (low_value & 63);
+        container.cardinality++;
+    }
+}
+
+/*
+ * Container normalization function choosing the representation for the cardinality
+ */
+void normalize_bitmap_container(bitmap_container& container) {
+    if (container.bitset_words.empty() && container.cardinality > BITMAP_ARRAY_LIMIT) {
+        container.bitset_words.assign(BITMAP_BITSET_WORDS, 0);
+        for (uint16_t low_value : container.sorted_values) {
+            container.bitset_words[low_value >> 6] |= 1ULL << (low_value & 63);
+        }
+        vector<uint16_t>().swap(container.sorted_values);
+    } else if (!container.bitset_words.empty() && container.cardinality <= BITMAP_ARRAY_LIMIT) {
+        container.sorted_values.clear();
+        container.sorted_values.reserve(container.cardinality);
+        for (size_t word_index = 0; word_index < BITMAP_BITSET_WORDS; word_index++) {
+            for (uint64_t remaining_bits = container.bitset_words[word_index]; remaining_bits != 0; remaining_bits &= remaining_bits - 1) {
+                size_t bit_position = bitset<64>((remaining_bits & (~remaining_bits + 1)) - 1).count();
+                container.sorted_values.push_back(static_cast<uint16_t>(word_index * 64 + bit_position));
+            }
+        }
+        vector<uint64_t>().swap(container.bitset_words);
+    }
+}
+
+/*
+ * Container combination function implementing AND, OR and AND NOT for one chunk
+ * Array pairs use sorted merges; any bitset operand switches to 1024-word logic
+ */
+bitmap_container combine_bitmap_containers(const bitmap_container& first_container, const bitmap_container& second_container, bitmap_operation operation) {
+    bitmap_container result_container;
+    result_container.high_key = first_container.high_key;
+    
+    if (first_container.bitset_words.empty() && second_container.bitset_words.empty()) {
+        auto output_iterator = back_inserter(result_container.sorted_values);
+        if (operation == bitmap_operation::intersection) {
+            set_intersection(first_container.sorted_values.begin(), first_container.sorted_values.end(),
+                             second_container.sorted_values.begin(), second_container.sorted_values.end(), output_iterator);
+        } else if (operation == bitmap_operation::union_all) {
+            set_union(first_container.sorted_values.begin(), first_container.sorted_values.end(),
+                      second_container.sorted_values.begin(), second_container.sorted_values.end(), output_iterator);
+        } else {
+            set_difference(first_container.sorted_values.begin(), first_container.sorted_values.end(),
+                           second_container.sorted_values.begin(), second_container.sorted_values.end(), output_iterator);
+        }
+        result_container.cardinality = static_cast<uint32_t>(result_container.sorted_values.size());
+        normalize_bitmap_container(result_container);
+        return result_container;
+    }
+    
+    // Expand array operands into temporary bitsets, then combine word by word
+    auto expand_words = [](const bitmap_container& container) -> vector<uint64_t> {
+        if (!container.bitset_words.empty()) {
+            return container.bitset_words;
+        }
+        vector<uint64_t> expanded_words(BITMAP_BITSET_WORDS, 0);
+        for (uint16_t low_value : container.sorted_values) {
+            expanded_words[low_value >> 6] |= 1ULL << (low_value & 63);
+        }
+        return expanded_words;
+    };
+    vector<uint64_t> first_words = expand_words(first_container);
+    vector<uint64_t> second_words = expand_words(second_container);
+    
+    result_container.bitset_words.resize(BITMAP_BITSET_WORDS);
+    uint32_t result_cardinality = 0;
+    for (size_t word_index = 0; word_index < BITMAP_BITSET_WORDS; word_index++) {
+        uint64_t combined_word = (operation == bitmap_operation::intersection) ? (first_words[word_index] & second_words[word_index])
+                               : (operation == bitmap_operation::union_all) ? (first_words[word_index] | second_words[word_index])
+                               : (first_words[word_index] & ~second_words[word_index]);
+        result_container.bitset_words[word_index] = combined_word;
+        result_cardinality += static_cast<uint32_t>(bitset<64>(combined_word).count());
+    }
+    result_container.cardinality = result_cardinality;
+    normalize_bitmap_container(result_container);
+    return result_container;
+}
+
+/*
+ * Bitmap combination function merging two container lists by high key
+ */
+compressed_bitmap combine_bitmaps(const compressed_bitmap& first_bitmap, const compressed_bitmap& second_bitmap, bitmap_operation operation) {
+    compressed_bitmap result_bitmap;
+    size_t first_position = 0, second_position = 0;
+    
+    while (first_position < first_bitmap.containers.size() || second_position < second_bitmap.containers.size()) {
+        bool first_available = first_position < first_bitmap.containers.size();
+        bool second_available = second_position < second_bitmap.containers.size();
+        uint32_t first_key = first_available ? first_bitmap.containers[first_position].high_key : 0x10000u;
+        uint32_t second_key = second_available ? second_bitmap.containers[second_position].high_key : 0x10000u;
+        
+        if (first_key == second_key) {
+            bitmap_container combined_container = combine_bitmap_containers(first_bitmap.containers[first_position++],
+                                                                            second_bitmap.containers[second_position++], operation);
+            if (combined_container.cardinality > 0) {
+                result_bitmap.containers.push_back(move(combined_container));
+            }
+        } else if (first_key < second_key) {
+            // Chunk only in the first operand: kept by OR and AND NOT
+            if (operation != bitmap_operation::intersection) {
+                result_bitmap.containers.push_back(first_bitmap.containers[first_position]);
+            }
+            first_position++;
+        } else {
+            // Chunk only in the second operand: kept by OR alone
+            if (operation == bitmap_operation::union_all) {
+                result_bitmap.containers.push_back(second_bitmap.containers[second_position]);
+            }
+            second_position++;
+        }
+    }
+    return result_bitmap;
+}
+
+/*
+ * Bitmap cardinality function summing container counts
+ */
+uint64_t count_bitmap_values(const compressed_bitmap& bitmap) {
+    uint64_t total_count = 0;
+    for (const bitmap_container& container : bitmap.containers) {
+        total_count += container.cardinality;
+    }
+    return total_count;
+}
+
+/*
+ * Tag index construction function building one bitmap per tag in a single pass
+ */
+void build_tag_index(tag_index& index, const vector<vector<string>>& option_tags) {
+    index.tag_bitmaps.clear();
+    index.all_options.containers.clear();
+    
+    for (size_t option_index = 0; option_index < option_tags.size(); option_index++) {
+        append_bitmap_value(index.all_options, static_cast<uint32_t>(option_index));
+        for (const string& tag_name : option_tags[option_index]) {
+            append_bitmap_value(index.tag_bitmaps[tag_name], static_cast<uint32_t>(option_index));
+        }
+    }
+}
+
+/*
+ * Tag expression evaluation function implementing a recursive-descent boolean parser
+ * Grammar: expression = term { OR term }; term = factor { AND factor };
+ *          factor = NOT factor | "(" expression ")" | tag
+ * Unknown tags match nothing; syntax errors are reported and return false
+ */
+bool evaluate_tag_expression(const string& expression_text, const tag_index& index, compressed_bitmap& result_bitmap) {
+    // Tokenize on whitespace, treating parentheses as standalone tokens
+    vector<string> expression_tokens;
+    string current_token;
+    for (char expression_character : expression_text) {
+        if (isspace(static_cast<unsigned char>(expression_character)) || expression_character == '(' || expression_character == ')') {
+            if (!current_token.empty()) {
+                expression_tokens.push_back(current_token);
+                current_token.clear();
+            }
+            if (expression_character == '(' || expression_character == ')') {
+                expression_tokens.push_back(string(1, expression_character));
+            }
+        } else {
+            current_token += expression_character;
+        }
+    }
+    if (!current_token.empty()) {
+        expression_tokens.push_back(current_token);
+    }
+    
+    size_t token_position = 0;
+    bool has_syntax_error = expression_tokens.empty();
+    auto is_keyword = [&](const char* keyword_upper, const char* keyword_lower) {
+        return token_position < expression_tokens.size() &&
+               (expression_tokens[token_position] == keyword_upper || expression_tokens[token_position] == keyword_lower);
+    };
+    
+    function<compressed_bitmap()> parse_expression;
+    function<compressed_bitmap()> parse_factor = [&]() -> compressed_bitmap {
+        if (token_position >= expression_tokens.size()) {
+            has_syntax_error = true;
+            return compressed_bitmap();
+        }
+        if (is_keyword("NOT", "not")) {
+            token_position++;
+            return combine_bitmaps(index.all_options, parse_factor(), bitmap_operation::difference);
+        }
+        if (expression_tokens[token_position] == "(") {
+            token_position++;
+            compressed_bitmap nested_bitmap = parse_expression();
+            if (token_position >= expression_tokens.size() || expression_tokens[token_position] != ")") {
+                has_syntax_error = true;
+            }
+            token_position++;
+            return nested_bitmap;
+        }
+        if (expression_tokens[token_position] == ")" || is_keyword("AND", "and") || is_keyword("OR", "or")) {
+            has_syntax_error = true;
+            token_position++;
+            return compressed_bitmap();
+        }
+        auto tag_entry = index.tag_bitmaps.find(expression_tokens[token_position++]);
+        return (tag_entry != index.tag_bitmaps.end()) ? tag_entry->second : compressed_bitmap();
+    };
+    auto parse_term = [&]() -> compressed_bitmap {
+        compressed_bitmap term_bitmap = parse_factor();
+        while (is_keyword("AND", "and")) {
+            token_position++;
+            term_bitmap = combine_bitmaps(term_bitmap, parse_factor(), bitmap_operation::intersection);
+        }
+        return term_bitmap;
+    };
+    parse_expression = [&]() -> compressed_bitmap {
+        compressed_bitmap expression_bitmap = parse_term();
+        while (is_keyword("OR", "or")) {
+            token_position++;
+            expression_bitmap = combine_bitmaps(expression_bitmap, parse_term(), bitmap_operation::union_all);
+        }
+        return expression_bitmap;
+    };
+    
+    if (!has_syntax_error) {
+        result_bitmap = parse_expression();
+    }
+    if (has_syntax_error || token_position != expression_tokens.size()) {
+        cout << "ERROR: Malformed tag expression '" << expression_text << "'." << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Filtered selection construction function computing prefix weights over the bitmap
+ * Cost is proportional to the matching options; labels and wheel structures are not copied
+ */
+void build_filtered_selection(filtered_selection_index& selection, const compressed_bitmap& matching_options, const vector<double>& option_weights) {
+    selection.matching_options = matching_options;
+    selection.container_cumulative.assign(matching_options.containers.size(), 0.0);
+    selection.slot_cumulative.assign(matching_options.containers.size(), vector<double>());
+    double running_total = 0.0;
+    
+    for (size_t container_index = 0; container_index < matching_options.containers.size(); container_index++) {
+        const bitmap_container& container = matching_options.containers[container_index];
+        size_t option_base = static_cast<size_t>(container.high_key) << 16;
+        vector<double>& slot_prefix = selection.slot_cumulative[container_index];
+        
+        if (container.bitset_words.empty()) {
+            slot_prefix.resize(container.sorted_values.size());
+            for (size_t slot_index = 0; slot_index < container.sorted_values.size(); slot_index++) {
+                running_total += option_weights[option_base + container.sorted_values[slot_index]];
+                slot_prefix[slot_index] = running_total;
+            }
+        } else {
+            slot_prefix.resize(BITMAP_BITSET_WORDS);
+            for (size_t word_index = 0; word_index < BITMAP_BITSET_WORDS; word_index++) {
+                for (uint64_t remaining_bits = container.bitset_words[word_index]; remaining_bits != 0; remaining_bits &= remaining_bits - 1) {
+                    size_t bit_position = bitset<64>((remaining_bits & (~remaining_bits + 1)) - 1).count();
+                    running_total += option_weights[option_base + word_index * 64 + bit_position];
+                }
+                slot_prefix[word_index] = running_total;
+            }
+        }
+        selection.container_cumulative[container_index] = running_total;
+    }
+    selection.total_weight = running_total;
+}
+
+/*
+ * Filtered selection function implementing weighted select over the matching bitmap
+ */
+size_t select_filtered_index(const filtered_selection_index& selection, const vector<double>& option_weights, uint64_t random_word) {
+    double target_weight = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0) * selection.total_weight;
+    return select_filtered_target(selection, option_weights, target_weight);
+}
+
+/*
+ * Filtered target function returning the matching option whose prefix interval holds a weight
+ * Container and slot are located by binary search; bitset words are resolved bit by bit
+ */
+size_t select_filtered_target(const filtered_selection_index& selection, const vector<double>& option_weights, double target_weight) {
+    size_t container_index = upper_bound(selection.container_cumulative.begin(), selection.container_cumulative.end(), target_weight)
+                             - selection.container_cumulative.begin();
+    container_index = min(container_index, selection.container_cumulative.size() - 1);
+    const bitmap_container& container = selection.matching_options.containers[container_index];
+    const vector<double>& slot_prefix = selection.slot_cumulative[container_index];
+    size_t option_base = static_cast<size_t>(container.high_key) << 16;
+    
+    size_t slot_index = upper_bound(slot_prefix.begin(), slot_prefix.end(), target_weight) - slot_prefix.begin();
+    slot_index = min(slot_index, slot_prefix.size() - 1);
+    if (container.bitset_words.empty()) {
+        return option_base + container.sorted_values[slot_index];
+    }
+    
+    // Walk the set bits of the chosen word until the remaining target is consumed
+    while (container.bitset_words[slot_index] == 0 && slot_index > 0) {
+        slot_index--;
+    }
+    double remaining_target = target_weight - (slot_index > 0 ? slot_prefix[slot_index - 1] : 
+                              (container_index > 0 ? selection.container_cumulative[container_index - 1] : 0.0));
+    size_t selected_option = option_base + slot_index * 64;
+    for (uint64_t remaining_bits = container.bitset_words[slot_index]; remaining_bits != 0; remaining_bits &= remaining_bits - 1) {
+        size_t bit_position = bitset<64>((remaining_bits & (~remaining_bits + 1)) - 1).count();
+        selected_option = option_base + slot_index * 64 + bit_position;
+        remaining_target -= option_weights[selected_option];
+        if (remaining_target < 0.0) {
+            break;
+        }
+    }
+    return selected_option;
+}
+
+/*
+ * Filtered decaying selection function sampling base + decayed boost weights among matching options
+ * Mirrors select_decaying_index: the boost index is built over epoch-scaled stored boosts,
+ * so it stays valid while time passes and only changes with boosts or renormalization
+ */
+size_t select_filtered_decaying_index(const filtered_selection_index& base_selection, const filtered_selection_index& boost_selection,
+                                      const decaying_wheel& wheel, uint64_t random_word) {
+    double decay_factor = compute_decay_factor(wheel);
+    double boost_total = boost_selection.total_weight * decay_factor;
+    double target_weight = static_cast<double>(random_word >> 11) * (1.0 / 9007199254740992.0) * (base_selection.total_weight + boost_total);
+    
+    if (target_weight < base_selection.total_weight || boost_total <= 0.0) {
+        return select_filtered_target(base_selection, wheel.base_weights, min(target_weight, base_selection.total_weight));
+    }
+    return select_filtered_target(boost_selection, wheel.stored_boosts, (target_weight - base_selection.total_weight) / decay_factor);
+}
+
+/*
+ * Fair rotation initialization function building the stride heap in O(n)
+ * Options start half a stride in, which centres each option's picks within its period
+ */
+void initialize_fair_rotation(fair_rotation_scheduler& scheduler, const vector<double>& option_weights) {
+    scheduler.option_strides.assign(option_weights.size(), 0.0);
+    scheduler.option_pick_counts.assign(option_weights.size(), 0);
+    scheduler.pass_heap.clear();
+    
+    for (size_t option_index = 0; option_index < option_weights.size(); option_index++) {
+        if (option_weights[option_index] <= 0.0) {
+            continue;
+        }
+        scheduler.option_strides[option_index] = 1.0 / option_weights[option_index];
+        scheduler.pass_heap.emplace_back(scheduler.option_strides[option_index] / 2.0, option_index);
+    }
+    make_heap(scheduler.pass_heap.begin(), scheduler.pass_heap.end(), greater<pair<double, size_t>>());
+}
+
+/*
+ * Fair rotation selection function returning the option with the smallest pass
+ * Each pick is one heap pop and one push, O(log n); ties go to the lower index.
+ * Passes are recomputed from pick counts rather than accumulated, so they never drift
+ * and advance_fair_rotation can reproduce them exactly
+ */
+size_t next_fair_rotation_index(fair_rotation_scheduler& scheduler) {
+    auto heap_order = greater<pair<double, size_t>>();
+    pop_heap(scheduler.pass_heap.begin(), scheduler.pass_heap.end(), heap_order);
+    pair<double, size_t>& chosen_entry = scheduler.pass_heap.back();
+    size_t selected_index = chosen_entry.second;
+    
+    uint64_t& pick_count = scheduler.option_pick_counts[selected_index];
+    pick_count++;
+    chosen_entry.first = (pick_count + 0.5) * scheduler.option_strides[selected_index];
+    push_heap(scheduler.pass_heap.begin(), scheduler.pass_heap.end(), heap_order);
+    return selected_index;
+}
+
+/*
+ * Fair rotation skip-ahead function positioning a fresh schedule after a number of picks
+ * Option i's k-th pick has pass (k + 1/2) * stride_i, so the pass of the last skipped pick
+ * is found by bisection over per-option pick counts: O(n) per step and about 64 steps,
+ * independent of how many picks are skipped
+ */
+void advance_fair_rotation(fair_rotation_scheduler& scheduler, uint64_t skipped_picks) {
+    if (skipped_picks == 0 || scheduler.pass_heap.empty()) {
+        return;
+    }
+    const vector<double>& option_strides = scheduler.option_strides;
+    
+    // Picks of one option whose pass is below (or at) a cut-off, starting from a rounded estimate
+    auto count_option_picks = [&](size_t option_index, double pass_limit, bool include_limit) -> uint64_t {
+        double option_stride = option_strides[option_index];
+        auto pick_within_limit = [&](uint64_t pick_index) {
+            double pick_pass = (pick_index + 0.5) * option_stride;
+            return include_limit ? pick_pass <= pass_limit : pick_pass < pass_limit;
+        };
+        double pick_estimate = floor(pass_limit / option_stride + 0.5);
+        uint64_t pick_count = pick_estimate > 0.0 ? static_cast<uint64_t>(pick_estimate) : 0;
+        while (pick_count > 0 && !pick_within_limit(pick_count - 1)) {
+            pick_count--;
+        }
+        while (pick_within_limit(pick_count)) {
+            pick_count++;
+        }
+        return pick_count;
+    };
+    auto count_schedule_picks = [&](double pass_limit, bool include_limit) -> uint64_t {
+        uint64_t pick_total = 0;
+        for (size_t option_index = 0; option_index < option_strides.size(); option_index++) {
+            if (option_strides[option_index] > 0.0) {
+                pick_total += count_option_picks(option_index, pass_limit, include_limit);
+            }
+        }
+        return pick_total;
+    };
+    
+    // Bisect for the smallest pass by which more than skipped_picks picks have been granted;
+    // each option contributes at least weight * pass - 1/2 picks, which bounds the search
+    double total_weight = 0.0;
+    for (double option_stride : option_strides) {
+        total_weight += (option_stride > 0.0) ? 1.0 / option_stride : 0.0;
+    }
+    double lower_pass = 0.0;
+    double upper_pass = (static_cast<double>(skipped_picks) + 1.0 + option_strides.size()) / total_weight;
+    while (count_schedule_picks(upper_pass, true) <= skipped_picks) {
+        upper_pass *= 2.0;
+    }
+    for (;;) {
+        double middle_pass = lower_pass + (upper_pass - lower_pass) / 2.0;
+        if (middle_pass <= lower_pass || middle_pass >= upper_pass) {
+            break;
+        }
+        if (count_schedule_picks(middle_pass, true) > skipped_picks) {
+            upper_pass = middle_pass;
+        } else {
+            lower_pass = middle_pass;
+        }
+    }
+    
+    // Options due exactly at the cut-off pass were taken in index order, as the heap breaks ties
+    uint64_t tied_picks = skipped_picks - count_schedule_picks(upper_pass, false);
+    scheduler.pass_heap.clear();
+    for (size_t option_index = 0; option_index < option_strides.size(); option_index++) {
+        if (option_strides[option_index] <= 0.0) {
+            continue;
+        }
+        uint64_t pick_count = count_option_picks(option_index, upper_pass, false);
+        if (tied_picks > 0 && (pick_count + 0.5) * option_strides[option_index] == upper_pass) {
+            pick_count++;
+            tied_picks--;
+        }
+        scheduler.option_pick_counts[option_index] = pick_count;
+        scheduler.pass_heap.emplace_back((pick_count + 0.5) * option_strides[option_index], option_index);
+    }
+    make_heap(scheduler.pass_heap.begin(), scheduler.pass_heap.end(), greater<pair<double, size_t>>());
+}
+
+/*
+ * Bandit sizing function appending uniform Beta(1, 1) priors for new options
+ */
+void resize_bandit_state(bandit_state& state, size_t option_count) {
+    state.success_mass.resize(option_count, 1.0);
+    state.failure_mass.resize(option_count, 1.0);
+    state.pull_counts.resize(option_count, 0);
+    state.reward_sums.resize(option_count, 0.0);
+}
+
+/*
+ * Bandit feedback function implementing the constant-time posterior update
+ */
+void record_bandit_reward(bandit_state& state, size_t option_index, double reward_value) {
+    state.success_mass[option_index] += reward_value;
+    state.failure_mass[option_index] += 1.0 - reward_value;
+    state.pull_counts[option_index]++;
+    state.reward_sums[option_index] += reward_value;
+    state.total_pulls++;
+}
+
+/*
+ * Batched gamma sampling function implementing Marsaglia-Tsang over whole arrays
+ * Uniforms and Box-Muller normals are produced for every pending lane in flat loops,
+ * the acceptance test runs as a separate pass, and only rejected lanes (a few percent) retry.
+ * Random words come from the caller, so seeded and secure sessions keep their generator
+ */
+void sample_gamma_batch(const vector<double>& shape_parameters, vector<double>& gamma_samples, const function<uint64_t()>& next_random_word) {
+    size_t sample_count = shape_parameters.size();
+    gamma_samples.assign(sample_count, 0.0);
+    
+    // Shapes below one are boosted to shape + 1 and corrected by U^(1 / shape) afterwards
+    vector<double> offset_values(sample_count), scale_values(sample_count), boost_factors(sample_count, 1.0);
+    for (size_t sample_index = 0; sample_index < sample_count; sample_index++) {
+        double effective_shape = shape_parameters[sample_index] < 1.0 ? shape_parameters[sample_index] + 1.0 : shape_parameters[sample_index];
+        offset_values[sample_index] = effective_shape - 1.0 / 3.0;
+        scale_values[sample_index] = 1.0 / sqrt(9.0 * offset_values[sample_index]);
+    }
+    for (size_t sample_index = 0; sample_index < sample_count; sample_index++) {
+        if (shape_parameters[sample_index] < 1.0) {
+            double boost_uniform = (static_cast<double>(next_random_word() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+            boost_factors[sample_index] = pow(boost_uniform, 1.0 / shape_parameters[sample_index]);
+        }
+    }
+    
+    vector<size_t> pending_lanes(sample_count);
+    for (size_t sample_index = 0; sample_index < sample_count; sample_index++) {
+        pending_lanes[sample_index] = sample_index;
+    }
+    vector<double> uniform_first, uniform_second, acceptance_uniforms, normal_values;
+    
+    while (!pending_lanes.empty()) {
+        size_t lane_count = pending_lanes.size();
+        uniform_first.resize(lane_count);
+        uniform_second.resize(lane_count);
+        acceptance_uniforms.resize(lane_count);
+        normal_values.resize(lane_count);
+        
+        // Pass 1: raw uniforms in (0, 1)
+        for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+            uniform_first[lane_index] = (static_cast<double>(next_random_word() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+            uniform_second[lane_index] = (static_cast<double>(next_random_word() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+            acceptance_uniforms[lane_index] = (static_cast<double>(next_random_word() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        }
+        
+        // Pass 2: Box-Muller normals, branch-free and independent per lane
+        for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+            normal_values[lane_index] = sqrt(-2.0 * log(uniform_first[lane_index])) * cos(6.283185307179586 * uniform_second[lane_index]);
+        }
+        
+        // Pass 3: acceptance test; survivors are written out, rejects are compacted for another round
+        size_t rejected_count = 0;
+        for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+            size_t sample_index = pending_lanes[lane_index];
+            double normal_value = normal_values[lane_index];
+            double cube_root = 1.0 + scale_values[sample_index] * normal_value;
+            double candidate_volume = cube_root * cube_root * cube_root;
+            double offset_value = offset_values[sample_index];
+            double squared_normal = normal_value * normal_value;
+            
+            bool is_accepted = cube_root > 0.0 &&
+                (acceptance_uniforms[lane_index] < 1.0 - 0.0331 * squared_normal * squared_normal ||
+                 log(acceptance_uniforms[lane_index]) < 0.5 * squared_normal + offset_value * (1.0 - candidate_volume + log(candidate_volume)));
+            if (is_accepted) {
+                gamma_samples[sample_index] = offset_value * candidate_volume * boost_factors[sample_index];
+            } else {
+                pending_lanes[rejected_count++] = sample_index;
+            }
+        }
+        pending_lanes.resize(rejected_count);
+    }
+}
+
+/*
+ * Bandit selection function implementing Thompson sampling and UCB1
+ * Thompson draws Beta(alpha, beta) = X / (X + Y) from one batched gamma pass over all options;
+ * UCB1 plays each untried option once, then maximizes mean + sqrt(2 ln N / n)
+ * Options with zero wheel weight are treated as disabled
+ */
+size_t select_bandit_index(const bandit_state& state, const vector<double>& option_weights, bandit_policy policy,
+                           const function<uint64_t()>& next_random_word) {
+    size_t option_count = option_weights.size();
+    size_t best_index = 0;
+    double best_score = -1.0;
+    
+    if (policy == bandit_policy::thompson_sampling) {
+        // Success and failure shapes are packed into one array so a single batch serves both
+        vector<double> shape_parameters(option_count * 2);
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            shape_parameters[option_index] = state.success_mass[option_index];
+            shape_parameters[option_count + option_index] = state.failure_mass[option_index];
+        }
+        vector<double> gamma_samples;
+        sample_gamma_batch(shape_parameters, gamma_samples, next_random_word);
+        
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            if (option_weights[option_index] <= 0.0) {
+                continue;
+            }
+            double beta_sample = gamma_samples[option_index] / (gamma_samples[option_index] + gamma_samples[option_count + option_index]);
+            if (beta_sample > best_score) {
+                best_score = beta_sample;
+                best_index = option_index;
+            }
+        }
+        return best_index;
+    }
+    
+    double exploration_log = log(static_cast<double>(max<uint64_t>(state.total_pulls, 1)));
+    for (size_t option_index = 0; option_index < option_count; option_index++) {
+        if (option_weights[option_index] <= 0.0) {
+            continue;
+        }
+        if (state.pull_counts[option_index] == 0) {
+            return option_index;
+        }
+        double pull_count = static_cast<double>(state.pull_counts[option_index]);
+        double confidence_score = state.reward_sums[option_index] / pull_count + sqrt(2.0 * exploration_log / pull_count);
+        if (confidence_score > best_score) {
+            best_score = confidence_score;
+            best_index = option_index;
+        }
+    }
+    return best_index;
+}
+
+/*
+ * Bulk key assignment function implementing a parallel chunked pipeline
+ * The input is read in newline-aligned chunks; each round hashes and assigns one chunk per
+ * worker in parallel, then writes the results in input order so output is deterministic
+ */
+void execute_bulk_key_assignment(const compiled_wheel& wheel, const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: BULK KEY ASSIGNMENT" << endl;
+    cout << "----------------------------" << endl;
+    
+    ifstream key_stream(session_configuration.key_input_path, ios::binary);
+    ofstream assignment_stream(session_configuration.key_output_path, ios::binary);
+    if (!key_stream || !assignment_stream) {
+        cout << "ERROR: Unable to open key input or assignment output file." << endl;
+        return;
+    }
+    if (wheel.total_weight <= 0.0) {
+        cout << "ERROR: Wheel has no positive weight." << endl;
+        return;
+    }
+    
+    size_t worker_count = max(1u, thread::hardware_concurrency());
+    vector<string> input_chunks(worker_count);
+    vector<string> output_chunks(worker_count);
+    vector<uint64_t> chunk_key_counts(worker_count);
+    string carried_partial_line;
+    uint64_t total_key_count = 0;
+    auto assignment_start = chrono::steady_clock::now();
+    
+    // Worker body: hash every key of the chunk first, then score them against the wheel
+    auto process_chunk = [&wheel](const string& input_chunk, string& output_chunk, uint64_t& chunk_key_count) {
+        vector<pair<size_t, size_t>> key_spans;
+        for (size_t line_start = 0; line_start < input_chunk.size();) {
+            size_t line_end = input_chunk.find('\n', line_start);
+            if (line_end == string::npos) {
+                line_end = input_chunk.size();
+            }
+            size_t key_end = (line_end > line_start && input_chunk[line_end - 1] == '\r') ? line_end - 1 : line_end;
+            if (key_end > line_start) {
+                key_spans.emplace_back(line_start, key_end - line_start);
+            }
+            line_start = line_end + 1;
+        }
+        
+        // Tight hashing pass: independent iterations keep the multiplier pipelines full
+        vector<uint64_t> key_hashes(key_spans.size());
+        for (size_t key_index = 0; key_index < key_spans.size(); key_index++) {
+            key_hashes[key_index] = hash_selection_key(input_chunk.data() + key_spans[key_index].first,
+                                                       key_spans[key_index].second, 0);
+        }
+        
+        output_chunk.clear();
+        output_chunk.reserve(input_chunk.size() * 2);
+        for (size_t key_index = 0; key_index < key_spans.size(); key_index++) {
+            size_t assigned_index = select_keyed_wheel_index(wheel, key_hashes[key_index]);
+            output_chunk.append(input_chunk, key_spans[key_index].first, key_spans[key_index].second);
+            output_chunk.push_back('\t');
+            output_chunk.append(wheel.choice_container[assigned_index]);
+            output_chunk.push_back('\n');
+        }
+        chunk_key_count = key_spans.size();
+    };
+    
+    while (key_stream) {
+        // Fill one chunk per worker, moving any trailing partial line into the next chunk
+        size_t filled_chunks = 0;
+        for (; filled_chunks < worker_count && key_stream; filled_chunks++) {
+            string& input_chunk = input_chunks[filled_chunks];
+            input_chunk.swap(carried_partial_line);
+            carried_partial_line.clear();
+            
+            size_t previous_size = input_chunk.size();
+            input_chunk.resize(previous_size + KEY_ASSIGNMENT_CHUNK_BYTES);
+            key_stream.read(&input_chunk[previous_size], KEY_ASSIGNMENT_CHUNK_BYTES);
+            input_chunk.resize(previous_size + static_cast<size_t>(key_stream.gcount()));
+            
+            size_t last_newline = input_chunk.rfind('\n');
+            if (key_stream && last_newline != string::npos) {
+                carried_partial_line.assign(input_chunk, last_newline + 1, string::npos);
+                input_chunk.resize(last_newline + 1);
+            } else if (key_stream) {
+                carried_partial_line.swap(input_chunk);
+                input_chunk.clear();
+            }
+        }
+        
+        vector<thread> worker_threads;
+        for (size_t chunk_index = 1; chunk_index < filled_chunks; chunk_index++) {
+            worker_threads.emplace_back(process_chunk, cref(input_chunks[chunk_index]),
+                                        ref(output_chunks[chunk_index]), ref(chunk_key_counts[chunk_index]));
+        }
+        if (filled_chunks > 0) {
+            process_chunk(input_chunks[0], output_chunks[0], chunk_key_counts[0]);
+        }
+        for (thread& worker_thread : worker_threads) {
+            worker_thread.join();
+        }
+        
+        for (size_t chunk_index = 0; chunk_index < filled_chunks; chunk_index++) {
+            assignment_stream.write(output_chunks[chunk_index].data(), output_chunks[chunk_index].size());
+            total_key_count += chunk_key_counts[chunk_index];
+        }
+    }
+    
+    // A final line without a newline terminator is still a key
+    if (!carried_partial_line.empty()) {
+        process_chunk(carried_partial_line, output_chunks[0], chunk_key_counts[0]);
+        assignment_stream.write(output_chunks[0].data(), output_chunks[0].size());
+        total_key_count += chunk_key_counts[0];
+    }
+    assignment_stream.flush();
+    
+    double elapsed_seconds = chrono::duration<double>(chrono::steady_clock::now() - assignment_start).count();
+    cout << "Keys Assigned: " << total_key_count << endl;
+    cout << "Worker Threads: " << worker_count << endl;
+    cout << "Elapsed Time: " << fixed << setprecision(2) << elapsed_seconds << " seconds" << endl;
+    cout << "Throughput: " << setprecision(2) << total_key_count / max(elapsed_seconds, 1e-9) / 1e6 << " million keys/s" << endl;
+    cout << "Output File: " << session_configuration.key_output_path << endl << endl;
+}
+
+/*
+ * Interactive session function implementing a persistent command loop
+ * The compiled wheel stays in memory so spins and edits skip the collection phase
+ */
+void execute_interactive_session(const vector<string>& choice_container, const vector<double>& option_weights,
+                                 const vector<vector<string>>& option_tags, const wheel_session_configuration& session_configuration) {
+    compiled_wheel session_wheel;
+    session_wheel.choice_container = choice_container;
+    session_wheel.option_weights = option_weights;
+    compile_wheel(session_wheel);
+    
+    // Cooldown state mirrors the compiled weights and restarts after every edit
+    size_t session_cooldown_length = session_configuration.cooldown_length;
+    cooldown_sampler session_cooldown;
+    initialize_cooldown_sampler(session_cooldown, session_wheel.option_weights, session_cooldown_length);
+    
+    // Fair rotation state follows the same restart-on-edit rule
+    bool session_fair_rotation = session_configuration.fair_rotation;
+    fair_rotation_scheduler session_rotation;
+    initialize_fair_rotation(session_rotation, session_wheel.option_weights);
+    
+    // Bandit posteriors survive weight edits; options carry their statistics when others are removed
+    bandit_policy session_bandit_policy = bandit_policy::disabled;
+    bandit_state session_bandit;
+    resize_bandit_state(session_bandit, session_wheel.choice_container.size());
+    
+    // Decaying boosts age with wall-clock time; option additions and removals clear them
+    bool session_decay_enabled = false;
+    double session_half_life = 0.0;
+    decaying_wheel session_decay;
+    auto session_clock_start = chrono::steady_clock::now();
+    auto session_seconds = [&session_clock_start]() -> double {
+        return chrono::duration<double>(chrono::steady_clock::now() - session_clock_start).count();
+    };
+    auto synchronize_decay_clock = [&]() {
+        advance_decaying_wheel(session_decay, session_seconds() - session_decay.current_time);
+    };
+    
+    // Tag filters are re-evaluated against the bitmap index whenever options or weights change
+    vector<vector<string>> session_option_tags = option_tags;
+    session_option_tags.resize(session_wheel.choice_container.size());
+    string session_filter_expression;
+    tag_index session_tag_index;
+    filtered_selection_index session_filter;
+    
+    // Decaying boosts inside a filter use a second index over the stored boosts, rebuilt before
+    // a spin once boosts, the filter or the decay epoch have changed
+    filtered_selection_index session_boost_filter;
+    bool session_boost_filter_stale = true;
+    double session_boost_filter_epoch = 0.0;
+    auto refresh_tag_filter = [&]() -> bool {
+        if (session_filter_expression.empty()) {
+            return true;
+        }
+        build_tag_index(session_tag_index, session_option_tags);
+        compressed_bitmap matching_options;
+        if (!evaluate_tag_expression(session_filter_expression, session_tag_index, matching_options)) {
+            session_filter_expression.clear();
+            return false;
+        }
+        build_filtered_selection(session_filter, matching_options, session_wheel.option_weights);
+        session_boost_filter_stale = true;
+        return true;
+    };
+    
+    // Seeded sessions advance the Philox counter; unseeded sessions use the thread-local MT19937-64
+    uint64_t next_spin_number = session_configuration.spin_number;
+    
+    // Optional background prefill moves generator work off the spin path
+    random_prefill_ring prefill_ring;
+    bool prefill_enabled = session_configuration.prefill_ring_size > 0 && !session_configuration.counter_based_mode
+                           && !session_configuration.secure_mode;
+    if (prefill_enabled) {
+        start_random_prefill(prefill_ring, session_configuration.prefill_ring_size, acquire_thread_local_generator()());
+    }
+    
+    chacha20_generator secure_generator;
+    if (session_configuration.secure_mode) {
+        seed_chacha20_generator(secure_generator);
+    }
+    
+    auto draw_random_word = [&]() -> uint64_t {
+        if (session_configuration.counter_based_mode) {
+            return generate_counter_based_word(session_configuration.session_seed, session_wheel.wheel_identifier,
+                                               next_spin_number++, FINAL_SELECTION_LANE);
+        }
+        if (session_configuration.secure_mode) {
+            return next_chacha20_word(secure_generator);
+        }
+        return prefill_enabled ? pop_prefilled_word(prefill_ring) : acquire_thread_local_generator()();
+    };
+    auto spin_session_wheel = [&]() -> size_t {
+        if (!session_filter_expression.empty()) {
+            if (session_decay_enabled) {
+                return select_filtered_decaying_index(session_filter, session_boost_filter, session_decay, draw_random_word());
+            }
+            return select_filtered_index(session_filter, session_wheel.option_weights, draw_random_word());
+        }
+        if (session_bandit_policy != bandit_policy::disabled) {
+            // Thompson sampling takes many words per spin; seeded sessions read them from successive lanes of one spin
+            uint64_t bandit_spin_number = next_spin_number;
+            uint32_t bandit_lane = FINAL_SELECTION_LANE;
+            size_t selected_index = select_bandit_index(session_bandit, session_wheel.option_weights, session_bandit_policy, [&]() -> uint64_t {
+                if (session_configuration.counter_based_mode) {
+                    return generate_counter_based_word(session_configuration.session_seed, session_wheel.wheel_identifier,
+                                                       bandit_spin_number, bandit_lane++);
+                }
+                return draw_random_word();
+            });
+            next_spin_number = bandit_spin_number + 1;
+            return selected_index;
+        }
+        if (session_fair_rotation) {
+            return next_fair_rotation_index(session_rotation);
+        }
+        if (session_decay_enabled) {
+            return select_decaying_index(session_decay, draw_random_word());
+        }
+        if (session_cooldown_length > 0) {
+            return draw_cooldown_index(session_cooldown, draw_random_word());
+        }
+        return select_compiled_wheel_index(session_wheel, draw_random_word());
+    };
+    
+    cout << "PHASE 2: INTERACTIVE SESSION MODE" << endl;
+    cout << "---------------------------------" << endl;
+    cout << "Commands: spin [count], key <text>, cooldown <spins>, rotation <on|off>," << endl;
+    cout << "          bandit [thompson|ucb|off], reward <option> <value>, decay <half-life s>," << endl;
+    cout << "          boost <option> <amount>, tag <option> <tag>, untag <option> <tag>," << endl;
+    cout << "          filter <expression|off>, weight <option> <value>, add <text>, remove <option>," << endl;
+    cout << "          rename <option> <text>, list, help, quit" << endl << endl;
+    
+    string command_line;
+    while (cout << "wheel> " && getline(cin, command_line)) {
+        istringstream command_stream(command_line);
+        string command_name;
+        if (!(command_stream >> command_name)) {
+            continue;
+        }
+        
+        if (command_name == "quit" || command_name == "exit") {
+            break;
+        } else if (command_name == "help") {
+            cout << "spin [count]              Spin once, or tally a batch of spins" << endl;
+            cout << "key <text>                Show the stable option assigned to a key" << endl;
+            cout << "cooldown <spins>          Forbid repeat winners within the last <spins> spins" << endl;
+            cout << "rotation <on|off>         Switch between weighted rotation and random draws" << endl;
+            cout << "bandit [policy]           Select thompson, ucb or off; no argument shows statistics" << endl;
+            cout << "reward <option> <value>   Report a reward in [0, 1] for an option" << endl;
+            cout << "decay <half-life s>       Enable decaying boosts (0 disables)" << endl;
+            cout << "boost <option> <amount>   Add weight that fades with the decay half-life" << endl;
+            cout << "tag <option> <tag>        Attach a tag such as region:eu to an option" << endl;
+            cout << "untag <option> <tag>      Detach a tag from an option" << endl;
+            cout << "filter <expression|off>   Restrict spins, e.g. 'region:eu AND NOT paused'" << endl;
+            cout << "weight <option> <value>   Set the relative weight of an option" << endl;
+            cout << "add <text>                Append a new option with weight 1" << endl;
+            cout << "remove <option>           Delete an option from the wheel" << endl;
+            cout << "rename <option> <text>    Replace the label of an option" << endl;
+            cout << "list                      Show options, weights and probabilities" << endl;
+            cout << "quit                      Leave the session" << endl;
+        } else if (command_name == "list") {
+            // With decay on, shares follow base weight plus the boost still remaining, as spins do
+            double share_total = session_wheel.total_weight;
+            if (session_decay_enabled) {
+                synchronize_decay_clock();
+                share_total = session_decay.base_total + session_decay.stored_boost_total * compute_decay_factor(session_decay);
+            }
+            for (size_t option_index = 0; option_index < session_wheel.choice_container.size(); option_index++) {
+                double option_mass = session_decay_enabled
+                    ? session_decay.base_weights[option_index] + decayed_boost_value(session_decay, option_index)
+                    : session_wheel.option_weights[option_index];
+                double option_share = (share_total > 0.0) ? 100.0 * option_mass / share_total : 0.0;
+                cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15)
+                     << session_wheel.choice_container[option_index] << " | weight " << fixed << setprecision(2) << right
+                     << setw(8) << session_wheel.option_weights[option_index] << " | " << setw(6) << option_share << "% |" << left;
+                if (session_decay_enabled) {
+                    cout << " boost " << fixed << setprecision(3) << decayed_boost_value(session_decay, option_index);
+                }
+                for (size_t tag_position = 0; tag_position < session_option_tags[option_index].size(); tag_position++) {
+                    cout << (tag_position == 0 ? " tags " : ",") << session_option_tags[option_index][tag_position];
+                }
+                cout << endl;
+            }
+        } else if (command_name == "spin") {
+            uint64_t batch_size = 1;
+            command_stream >> batch_size;
+            double boost_total = 0.0, filtered_boost_total = 0.0;
+            if (session_decay_enabled) {
+                synchronize_decay_clock();
+                if (!session_filter_expression.empty() &&
+                    (session_boost_filter_stale || session_boost_filter_epoch != session_decay.epoch_time)) {
+                    build_filtered_selection(session_boost_filter, session_filter.matching_options, session_decay.stored_boosts);
+                    session_boost_filter_epoch = session_decay.epoch_time;
+                    session_boost_filter_stale = false;
+                }
+                boost_total = session_decay.stored_boost_total * compute_decay_factor(session_decay);
+                filtered_boost_total = session_boost_filter.total_weight * compute_decay_factor(session_decay);
+            }
+            
+            // Guards check the mass the active path draws from; unfiltered bandit and rotation spins ignore boosts
+            bool uses_boosts = session_decay_enabled && session_bandit_policy == bandit_policy::disabled && !session_fair_rotation;
+            if (batch_size == 0 || (session_filter_expression.empty() && session_wheel.total_weight + (uses_boosts ? boost_total : 0.0) <= 0.0)) {
+                cout << "ERROR: Wheel has no positive weight or spin count is zero." << endl;
+                continue;
+            }
+            if (!session_filter_expression.empty() && session_filter.total_weight + filtered_boost_total <= 0.0) {
+                cout << "ERROR: No weighted option matches the active filter." << endl;
+                continue;
+            }
+            
+            if (batch_size == 1) {
+                size_t selected_index = spin_session_wheel();
+                cout << "SELECTED OPTION: " << read_compiled_wheel_label(session_wheel, selected_index)
+                     << " (" << selected_index + 1 << " of " << session_wheel.choice_container.size() << ")" << endl;
+                continue;
+            }
+            
+            // Batch spins print one aggregated tally instead of individual reports
+            vector<uint64_t> option_counts(session_wheel.choice_container.size(), 0);
+            for (uint64_t spin_index = 0; spin_index < batch_size; spin_index++) {
+                option_counts[spin_session_wheel()]++;
+            }
+            for (size_t option_index = 0; option_index < option_counts.size(); option_index++) {
+                cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15)
+                     << session_wheel.choice_container[option_index] << " | " << right << setw(12) << option_counts[option_index]
+                     << " wins | " << fixed << setprecision(2) << setw(6)
+                     << 100.0 * option_counts[option_index] / batch_size << "% |" << left << endl;
+            }
+        } else if (command_name == "cooldown") {
+            if (!(command_stream >> session_cooldown_length)) {
+                cout << "ERROR: Cooldown must be a non-negative spin count." << endl;
+                session_cooldown_length = 0;
+            }
+            initialize_cooldown_sampler(session_cooldown, session_wheel.option_weights, session_cooldown_length);
+            cout << "Cooldown Window: " << session_cooldown.cooldown_length << " spins" << endl;
+        } else if (command_name == "rotation") {
+            string rotation_state;
+            command_stream >> rotation_state;
+            if (rotation_state != "on" && rotation_state != "off") {
+                cout << "ERROR: Rotation state must be 'on' or 'off'." << endl;
+                continue;
+            }
+            session_fair_rotation = (rotation_state == "on");
+            initialize_fair_rotation(session_rotation, session_wheel.option_weights);
+            cout << "Selection Mode: " << (session_fair_rotation ? "Fair rotation (stride scheduling)" : "Random draw") << endl;
+        } else if (command_name == "bandit") {
+            string policy_name;
+            if (!(command_stream >> policy_name)) {
+                for (size_t option_index = 0; option_index < session_wheel.choice_container.size(); option_index++) {
+                    double posterior_mean = session_bandit.success_mass[option_index]
+                        / (session_bandit.success_mass[option_index] + session_bandit.failure_mass[option_index]);
+                    cout << "| " << right << setw(2) << (option_index + 1) << ". " << left << setw(15)
+                         << session_wheel.choice_container[option_index] << " | rewards " << right << setw(8)
+                         << session_bandit.pull_counts[option_index] << " | posterior mean " << fixed << setprecision(3)
+                         << posterior_mean << " |" << left << endl;
+                }
+                continue;
+            }
+            if (policy_name == "thompson") {
+                session_bandit_policy = bandit_policy::thompson_sampling;
+            } else if (policy_name == "ucb") {
+                session_bandit_policy = bandit_policy::upper_confidence_bound;
+            } else if (policy_name == "off") {
+                session_bandit_policy = bandit_policy::disabled;
+            } else {
+                cout << "ERROR: Bandit policy must be 'thompson', 'ucb' or 'off'." << endl;
+                continue;
+            }
+            cout << "Bandit Policy: " << policy_name << endl;
+        } else if (command_name == "reward") {
+            size_t option_number = 0;
+            double reward_value = -1.0;
+            if (!(command_stream >> option_number >> reward_value) || option_number < 1
+                || option_number > session_wheel.choice_container.size() || reward_value < 0.0 || reward_value > 1.0) {
+                cout << "ERROR: Usage is 'reward <option 1-" << session_wheel.choice_container.size() << "> <value 0-1>'." << endl;
+                continue;
+            }
+            record_bandit_reward(session_bandit, option_number - 1, reward_value);
+        } else if (command_name == "decay") {
+            if (!(command_stream >> session_half_life) || session_half_life < 0.0) {
+                cout << "ERROR: Half-life must be a non-negative number of seconds." << endl;
+                continue;
+            }
+            session_decay_enabled = session_half_life > 0.0;
+            initialize_decaying_wheel(session_decay, session_wheel.option_weights, session_half_life, session_seconds());
+            session_boost_filter_stale = true;
+            cout << "Boost Half-Life: " << (session_decay_enabled ? to_string(session_half_life) + " seconds" : string("disabled")) << endl;
+        } else if (command_name == "boost") {
+            size_t option_number = 0;
+            double boost_amount = -1.0;
+            if (!session_decay_enabled) {
+                cout << "ERROR: Enable decay with 'decay <half-life seconds>' before boosting." << endl;
+                continue;
+            }
+            if (!(command_stream >> option_number >> boost_amount) || option_number < 1
+                || option_number > session_wheel.choice_container.size() || boost_amount < 0.0) {
+                cout << "ERROR: Usage is 'boost <option 1-" << session_wheel.choice_container.size() << "> <amount >= 0>'." << endl;
+                continue;
+            }
+            synchronize_decay_clock();
+            boost_decaying_option(session_decay, option_number - 1, boost_amount);
+            session_boost_filter_stale = true;
+        } else if (command_name == "tag" || command_name == "untag") {
+            size_t option_number = 0;
+            string tag_name;
+            if (!(command_stream >> option_number >> tag_name) || option_number < 1 || option_number > session_wheel.choice_container.size()) {
+                cout << "ERROR: Usage is '" << command_name << " <option 1-" << session_wheel.choice_container.size() << "> <tag>'." << endl;
+                continue;
+            }
+            vector<string>& tag_list = session_option_tags[option_number - 1];
+            auto tag_position = find(tag_list.begin(), tag_list.end(), tag_name);
+            if (command_name == "tag" && tag_position == tag_list.end()) {
+                tag_list.push_back(tag_name);
+            } else if (command_name == "untag" && tag_position != tag_list.end()) {
+                tag_list.erase(tag_position);
+            }
+            refresh_tag_filter();
+        } else if (command_name == "filter") {
+            string filter_expression;
+            getline(command_stream >> ws, filter_expression);
+            if (filter_expression.empty() || filter_expression == "off") {
+                session_filter_expression.clear();
+                cout << "Tag Filter: disabled" << endl;
+                continue;
+            }
+            session_filter_expression = filter_expression;
+            if (refresh_tag_filter()) {
+                cout << "Tag Filter: " << count_bitmap_values(session_filter.matching_options) << " matching options" << endl;
+            }
+        } else if (command_name == "key") {
+            string selection_key;
+            getline(command_stream >> ws, selection_key);
+            if (selection_key.empty() || session_wheel.total_weight <= 0.0) {
+                cout << "ERROR: A non-empty key and a wheel with positive weight are required." << endl;
+                continue;
+            }
+            size_t assigned_index = select_keyed_wheel_index(session_wheel,
+                hash_selection_key(selection_key.data(), selection_key.size(), 0));
+            cout << "ASSIGNED OPTION: " << read_compiled_wheel_label(session_wheel, assigned_index)
+                 << " (" << assigned_index + 1 << " of " << session_wheel.choice_container.size() << ")" << endl;
+        } else if (command_name == "weight" || command_name == "remove" || command_name == "rename") {
+            size_t option_number = 0;
+            if (!(command_stream >> option_number) || option_number < 1 || option_number > session_wheel.choice_container.size()) {
+                cout << "ERROR: Option number must be between 1 and " << session_wheel.choice_container.size() << "." << endl;
+                continue;
+            }
+            size_t option_index = option_number - 1;
+            
+            if (command_name == "weight") {
+                double new_weight = -1.0;
+                if (!(command_stream >> new_weight) || new_weight < 0.0) {
+                    cout << "ERROR: Weight must be a non-negative number." << endl;
+                    continue;
+                }
+                session_wheel.option_weights[option_index] = new_weight;
+                if (session_decay_enabled) {
+                    set_decaying_base_weight(session_decay, option_index, new_weight);
+                }
+            } else if (command_name == "remove") {
+                if (session_wheel.choice_container.size() <= 2) {
+                    cout << "ERROR: A wheel requires at least 2 options." << endl;
+                    continue;
+                }
+                session_wheel.choice_container.erase(session_wheel.choice_container.begin() + option_index);
+                session_wheel.option_weights.erase(session_wheel.option_weights.begin() + option_index);
+                session_bandit.success_mass.erase(session_bandit.success_mass.begin() + option_index);
+                session_bandit.failure_mass.erase(session_bandit.failure_mass.begin() + option_index);
+                session_bandit.total_pulls -= session_bandit.pull_counts[option_index];
+                session_bandit.pull_counts.erase(session_bandit.pull_counts.begin() + option_index);
+                session_bandit.reward_sums.erase(session_bandit.reward_sums.begin() + option_index);
+                session_option_tags.erase(session_option_tags.begin() + option_index);
+            } else {
+                string replacement_text;
+                getline(command_stream >> ws, replacement_text);
+                if (replacement_text.empty()) {
+                    cout << "ERROR: Empty input detected. Please enter valid option text." << endl;
+                    continue;
+                }
+                session_wheel.choice_container[option_index] = replacement_text;
+            }
+            compile_wheel(session_wheel);
+            initialize_cooldown_sampler(session_cooldown, session_wheel.option_weights, session_cooldown_length);
+            initialize_fair_rotation(session_rotation, session_wheel.option_weights);
+            if (session_decay_enabled && session_decay.base_weights.size() != session_wheel.option_weights.size()) {
+                initialize_decaying_wheel(session_decay, session_wheel.option_weights, session_half_life, session_seconds());
+            }
+            refresh_tag_filter();
+        } else if (command_name == "add") {
+            string option_text;
+            getline(command_stream >> ws, option_text);
+            if (option_text.empty()) {
+                cout << "ERROR: Empty input detected. Please enter valid option text." << endl;
+                continue;
+            }
+            session_wheel.choice_container.push_back(option_text);
+            session_wheel.option_weights.push_back(1.0);
+            session_option_tags.emplace_back();
+            resize_bandit_state(session_bandit, session_wheel.choice_container.size());
+            compile_wheel(session_wheel);
+            initialize_cooldown_sampler(session_cooldown, session_wheel.option_weights, session_cooldown_length);
+            initialize_fair_rotation(session_rotation, session_wheel.option_weights);
+            if (session_decay_enabled && session_decay.base_weights.size() != session_wheel.option_weights.size()) {
+                initialize_decaying_wheel(session_decay, session_wheel.option_weights, session_half_life, session_seconds());
+            }
+            refresh_tag_filter();
+        } else {
+            cout << "ERROR: Unknown command '" << command_name << "'. Type 'help' for the command list." << endl;
+        }
+    }
+    cout << endl;
+    
+    if (prefill_enabled) {
+        stop_random_prefill(prefill_ring);
+    }
+}
+
+/*
+ * Prefill startup function implementing ring allocation and producer launch
+ * The requested size is rounded up to a power of two for mask-based wrapping
+ */
+void start_random_prefill(random_prefill_ring& prefill_ring, size_t requested_size, uint64_t seed_value) {
+    size_t ring_capacity = 1;
+    while (ring_capacity < requested_size) {
+        ring_capacity <<= 1;
+    }
+    prefill_ring.ring_slots.assign(ring_capacity, 0);
+    prefill_ring.capacity_mask = ring_capacity - 1;
+    prefill_ring.low_water_mark = ring_capacity / 4;
+    prefill_ring.fallback_generator.seed(seed_value ^ 0xA5A5A5A5A5A5A5A5ULL);
+    prefill_ring.stop_requested.store(false);
+    
+    prefill_ring.producer_thread = thread([&prefill_ring, seed_value]() {
+        mt19937_64 producer_generator(seed_value);
+        uint64_t local_write_position = prefill_ring.write_position.load(memory_order_relaxed);
+        
+        while (!prefill_ring.stop_requested.load(memory_order_relaxed)) {
+            // Fill every free slot, then publish the batch with a single release store
+            uint64_t consumer_position = prefill_ring.read_position.load(memory_order_acquire);
+            uint64_t free_slots = prefill_ring.ring_slots.size() - (local_write_position - consumer_position);
+            for (uint64_t slot_counter = 0; slot_counter < free_slots; slot_counter++) {
+                prefill_ring.ring_slots[(local_write_position + slot_counter) & prefill_ring.capacity_mask] = producer_generator();
+            }
+            local_write_position += free_slots;
+            prefill_ring.write_position.store(local_write_position, memory_order_release);
+            
+            // Park until the consumer drains to the low-water mark; the fence pairs with the
+            // consumer's so either it sees the waiting flag or the predicate sees its pop
+            unique_lock<mutex> producer_lock(prefill_ring.producer_mutex);
+            prefill_ring.producer_waiting.store(true, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            prefill_ring.producer_wakeup.wait(producer_lock, [&prefill_ring, local_write_position]() {
+                return prefill_ring.stop_requested.load(memory_order_relaxed) ||
+                       local_write_position - prefill_ring.read_position.load(memory_order_acquire) <= prefill_ring.low_water_mark;
+            });
+            prefill_ring.producer_waiting.store(false, memory_order_relaxed);
+        }
+    });
+}
+
+/*
+ * Prefill consumer function returning the next buffered word
+ * An empty ring never blocks the caller; the word is generated inline instead.
+ * Pops at or below the low-water mark wake a parked producer
+ */
+uint64_t pop_prefilled_word(random_prefill_ring& prefill_ring) {
+    uint64_t local_read_position = prefill_ring.read_position.load(memory_order_relaxed);
+    uint64_t producer_position = prefill_ring.write_position.load(memory_order_acquire);
+    if (local_read_position == producer_position) {
+        return prefill_ring.fallback_generator();
+    }
+    
+    uint64_t random_word = prefill_ring.ring_slots[local_read_position & prefill_ring.capacity_mask];
+    prefill_ring.read_position.store(local_read_position + 1, memory_order_release);
+    if (producer_position - (local_read_position + 1) <= prefill_ring.low_water_mark) {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (prefill_ring.producer_waiting.load(memory_order_relaxed)) {
+            lock_guard<mutex> producer_lock(prefill_ring.producer_mutex);
+            prefill_ring.producer_wakeup.notify_one();
+        }
+    }
+    return random_word;
+}
+
+/*
+ * Prefill shutdown function implementing producer termination
+ */
+void stop_random_prefill(random_prefill_ring& prefill_ring) {
+    {
+        lock_guard<mutex> producer_lock(prefill_ring.producer_mutex);
+        prefill_ring.stop_requested.store(true);
+    }
+    prefill_ring.producer_wakeup.notify_one();
+    if (prefill_ring.producer_thread.joinable()) {
+        prefill_ring.producer_thread.join();
+    }
+}
+
+/*
+ * Benchmark suite function implementing engine throughput measurements
+ * Reports construction and spin cost of the inline small wheel against vector<string> wheels
+ */
+void execute_benchmark_suite() {
+    cout << "PHASE 2: PERFORMANCE BENCHMARK SUITE" << endl;
+    cout << "------------------------------------" << endl;
+    
+    // SplitMix64 keeps generator cost negligible next to the structures under test
+    uint64_t benchmark_state = 0x9E3779B97F4A7C15ULL;
+    auto next_benchmark_word = [&benchmark_state]() -> uint64_t {
+        uint64_t mixed_value = (benchmark_state += 0x9E3779B97F4A7C15ULL);
+        mixed_value = (mixed_value ^ (mixed_value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        mixed_value = (mixed_value ^ (mixed_value >> 27)) * 0x94D049BB133111EBULL;
+        return mixed_value ^ (mixed_value >> 31);
+    };
+    auto elapsed_nanoseconds = [](chrono::steady_clock::time_point start_time) -> double {
+        return static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start_time).count());
+    };
+    
+    const int construction_rounds = 200000;
+    const int spin_rounds = 20000000;
+    uint64_t benchmark_checksum = 0;
+    
+    cout << "Small Wheel vs vector<string> Wheel (nanoseconds per operation):" << endl;
+    cout << "| Options | Build small | Build vector | Spin small | Spin vector |" << endl;
+    
+    for (size_t option_count : {2, 4, 8, 16}) {
+        vector<string> benchmark_choices;
+        for (size_t option_index = 0; option_index < option_count; option_index++) {
+            benchmark_choices.push_back("Benchmark option number " + to_string(option_index + 1));
+        }
+        vector<double> benchmark_weights(option_count, 1.0);
+        
+        // Construction cost: inline table versus heap-backed containers and prefix sums
+        small_wheel inline_wheel;
+        auto phase_start = chrono::steady_clock::now();
+        for (int round_index = 0; round_index < construction_rounds; round_index++) {
+            benchmark_weights[0] = 1.0 + (round_index & 1);
+            build_small_wheel(benchmark_choices, benchmark_weights, inline_wheel);
+            benchmark_checksum += inline_wheel.interval_starts[1];
+        }
+        double small_build_cost = elapsed_nanoseconds(phase_start) / construction_rounds;
+        
+        phase_start = chrono::steady_clock::now();
+        for (int round_index = 0; round_index < construction_rounds; round_index++) {
+            vector<string> general_choices(benchmark_choices);
+            vector<double> general_weights(benchmark_weights);
+            vector<double> general_cumulative(option_count);
+            double running_total = 0.0;
+            for (size_t option_index = 0; option_index < option_count; option_index++) {
+                running_total += general_weights[option_index];
+                general_cumulative[option_index] = running_total;
+            }
+            benchmark_checksum += general_choices.size() + static_cast<uint64_t>(general_cumulative.back());
+        }
+        double vector_build_cost = elapsed_nanoseconds(phase_start) / construction_rounds;
+        
+        // Spin cost: select an index and touch the winning label
+        compiled_wheel general_wheel;
+        general_wheel.choice_container = benchmark_choices;
+        compile_wheel(general_wheel);
+        general_wheel.uses_small_wheel = false;
+        
+        phase_start = chrono::steady_clock::now();
+        for (int round_index = 0; round_index < spin_rounds; round_index++) {
+            size_t selected_index = select_small_wheel_index(inline_wheel, next_benchmark_word());
+            benchmark_checksum += inline_wheel.label_offsets[selected_index + 1] - inline_wheel.label_offsets[selected_index];
+        }
+        double small_spin_cost = elapsed_nanoseconds(phase_start) / spin_rounds;
+        
+        phase_start = chrono::steady_clock::now();
+        for (int round_index = 0; round_index < spin_rounds; round_index++) {
+            size_t selected_index = select_compiled_wheel_index(general_wheel, next_benchmark_word());
+            benchmark_checksum += general_wheel.choice_container[selected_index].size();
+        }
+        double vector_spin_cost = elapsed_nanoseconds(phase_start) / spin_rounds;
+        
+        cout << "| " << right << setw(7) << option_count << " | " << fixed << setprecision(2)
+             << setw(11) << small_build_cost << " | " << setw(12) << vector_build_cost << " | "
+             << setw(10) << small_spin_cost << " | " << setw(11) << vector_spin_cost << " |" << left << endl;
+    }
+    
+    cout << endl;
+    
+    // Per-spin latency distribution with inline generation versus background prefill
+    const size_t latency_spin_count = 1000000;
+    const size_t prefill_ring_size = 4096;
+    compiled_wheel latency_wheel;
+    for (size_t option_index = 0; option_index < 8; option_index++) {
+        latency_wheel.choice_container.push_back("Latency option " + to_string(option_index + 1));
+    }
+    compile_wheel(latency_wheel);
+    vector<double> latency_samples(latency_spin_count);
+    
+    mt19937_64 inline_generator(benchmark_state);
+    for (size_t spin_index = 0; spin_index < latency_spin_count; spin_index++) {
+        auto spin_start = chrono::steady_clock::now();
+        benchmark_checksum += select_compiled_wheel_index(latency_wheel, inline_generator());
+        latency_samples[spin_index] = elapsed_nanoseconds(spin_start);
+    }
+    cout << "Spin Latency (nanoseconds, includes clock overhead):" << endl;
+    display_latency_percentiles("Inline MT19937-64", latency_samples);
+    
+    random_prefill_ring prefill_ring;
+    start_random_prefill(prefill_ring, prefill_ring_size, benchmark_state);
+    this_thread::sleep_for(chrono::milliseconds(10));
+    for (size_t spin_index = 0; spin_index < latency_spin_count; spin_index++) {
+        auto spin_start = chrono::steady_clock::now();
+        benchmark_checksum += select_compiled_wheel_index(latency_wheel, pop_prefilled_word(prefill_ring));
+        latency_samples[spin_index] = elapsed_nanoseconds(spin_start);
+    }
+    stop_random_prefill(prefill_ring);
+    display_latency_percentiles("Prefill ring (" + to_string(prefill_ring_size) + ")", latency_samples);
+    cout << endl;
+    
+    // Generator throughput: fast mode versus secure mode
+    const int generator_rounds = 50000000;
+    mt19937_64 fast_generator(benchmark_state);
+    auto phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < generator_rounds; round_index++) {
+        benchmark_checksum += fast_generator();
+    }
+    double fast_word_cost = elapsed_nanoseconds(phase_start) / generator_rounds;
+    
+    chacha20_generator secure_generator;
+    seed_chacha20_generator(secure_generator);
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < generator_rounds; round_index++) {
+        benchmark_checksum += next_chacha20_word(secure_generator);
+    }
+    double secure_word_cost = elapsed_nanoseconds(phase_start) / generator_rounds;
+    
+    // Keyed assignment throughput over a batch of synthetic user identifiers
+    compiled_wheel keyed_wheel;
+    for (size_t option_index = 0; option_index < 16; option_index++) {
+        keyed_wheel.choice_container.push_back("Bucket " + to_string(option_index + 1));
+    }
+    compile_wheel(keyed_wheel);
+    vector<string> selection_keys(1000000);
+    for (size_t key_index = 0; key_index < selection_keys.size(); key_index++) {
+        selection_keys[key_index] = "user-" + to_string(key_index * 7919);
+    }
+    vector<uint32_t> assigned_indices;
+    phase_start = chrono::steady_clock::now();
+    assign_keys_to_options(keyed_wheel, selection_keys, assigned_indices);
+    double keyed_batch_seconds = elapsed_nanoseconds(phase_start) / 1e9;
+    benchmark_checksum += assigned_indices[selection_keys.size() / 2];
+    
+    // Fair rotation pick cost on a very large wheel
+    const size_t rotation_option_count = 1000000;
+    const int rotation_rounds = 5000000;
+    vector<double> rotation_weights(rotation_option_count);
+    for (size_t option_index = 0; option_index < rotation_option_count; option_index++) {
+        rotation_weights[option_index] = 1.0 + static_cast<double>(next_benchmark_word() % 100);
+    }
+    fair_rotation_scheduler rotation_scheduler;
+    initialize_fair_rotation(rotation_scheduler, rotation_weights);
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < rotation_rounds; round_index++) {
+        benchmark_checksum += next_fair_rotation_index(rotation_scheduler);
+    }
+    double rotation_pick_cost = elapsed_nanoseconds(phase_start) / rotation_rounds;
+    
+    // Decayed versus static spin cost on a 10^7-option wheel; ageing touches no options
+    const size_t decay_option_count = 10000000;
+    const int decay_rounds = 2000000;
+    decaying_wheel decay_wheel;
+    initialize_decaying_wheel(decay_wheel, vector<double>(decay_option_count, 1.0), 60.0, 0.0);
+    for (size_t boost_index = 0; boost_index < decay_option_count; boost_index += 97) {
+        boost_decaying_option(decay_wheel, boost_index, 50.0);
+    }
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < decay_rounds; round_index++) {
+        benchmark_checksum += find_fenwick_index(decay_wheel.base_tree,
+            static_cast<double>(next_benchmark_word() >> 11) * (1.0 / 9007199254740992.0) * decay_wheel.base_total);
+    }
+    double static_tree_cost = elapsed_nanoseconds(phase_start) / decay_rounds;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < decay_rounds; round_index++) {
+        if ((round_index & 1023) == 0) {
+            advance_decaying_wheel(decay_wheel, 1.0);
+        }
+        benchmark_checksum += select_decaying_index(decay_wheel, next_benchmark_word());
+    }
+    double decayed_tree_cost = elapsed_nanoseconds(phase_start) / decay_rounds;
+    vector<double>().swap(decay_wheel.base_tree);
+    vector<double>().swap(decay_wheel.boost_tree);
+    
+    // Tag-filtered spins over a large catalog without building a filtered wheel
+    const size_t tagged_option_count = 1000000;
+    const int filtered_rounds = 2000000;
+    vector<vector<string>> catalog_tags(tagged_option_count);
+    vector<double> catalog_weights(tagged_option_count);
+    for (size_t option_index = 0; option_index < tagged_option_count; option_index++) {
+        catalog_tags[option_index].push_back(option_index % 10 < 3 ? "region:eu" : "region:us");
+        if (option_index % 20 == 0) {
+            catalog_tags[option_index].push_back("paused");
+        }
+        catalog_weights[option_index] = 1.0 + static_cast<double>(option_index % 7);
+    }
+    tag_index catalog_index;
+    build_tag_index(catalog_index, catalog_tags);
+    compressed_bitmap catalog_matches;
+    phase_start = chrono::steady_clock::now();
+    evaluate_tag_expression("region:eu AND NOT paused", catalog_index, catalog_matches);
+    filtered_selection_index catalog_filter;
+    build_filtered_selection(catalog_filter, catalog_matches, catalog_weights);
+    double filter_build_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < filtered_rounds; round_index++) {
+        benchmark_checksum += select_filtered_index(catalog_filter, catalog_weights, next_benchmark_word());
+    }
+    double filtered_spin_cost = elapsed_nanoseconds(phase_start) / filtered_rounds;
+    
+    // Full shuffles of a large label list: std::shuffle against MergeShuffle on one and all threads
+    const size_t shuffle_option_count = 1 << 22;
+    vector<string> shuffle_labels(shuffle_option_count);
+    for (size_t option_index = 0; option_index < shuffle_option_count; option_index++) {
+        shuffle_labels[option_index] = "Option " + to_string(option_index);
+    }
+    vector<string> reference_labels = shuffle_labels;
+    mt19937_64 shuffle_generator(next_benchmark_word());
+    phase_start = chrono::steady_clock::now();
+    shuffle(reference_labels.begin(), reference_labels.end(), shuffle_generator);
+    double standard_shuffle_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    vector<string> single_thread_labels = shuffle_labels;
+    phase_start = chrono::steady_clock::now();
+    shuffle_options_in_parallel(single_thread_labels, 42, 1);
+    double merge_single_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    size_t shuffle_threads = max(1u, thread::hardware_concurrency());
+    phase_start = chrono::steady_clock::now();
+    shuffle_options_in_parallel(shuffle_labels, 42, shuffle_threads);
+    double merge_parallel_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    bool shuffle_reproducible = (shuffle_labels == single_thread_labels);
+    benchmark_checksum += reference_labels.front().size() + shuffle_labels.front().size();
+    vector<string>().swap(shuffle_labels);
+    vector<string>().swap(single_thread_labels);
+    vector<string>().swap(reference_labels);
+    
+    // Weighted full orderings: key generation and radix sort against a comparison sort
+    const size_t ordering_option_count = 10000000;
+    vector<double> ordering_weights(ordering_option_count);
+    for (size_t option_index = 0; option_index < ordering_option_count; option_index++) {
+        ordering_weights[option_index] = 1.0 + static_cast<double>(option_index % 13);
+    }
+    vector<ordering_key_entry> ordering_keys;
+    phase_start = chrono::steady_clock::now();
+    generate_exponential_keys(ordering_weights, 42, ordering_keys, shuffle_threads);
+    double key_generation_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    vector<ordering_key_entry> comparison_keys = ordering_keys;
+    phase_start = chrono::steady_clock::now();
+    radix_sort_key_entries(ordering_keys, shuffle_threads);
+    double radix_sort_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    phase_start = chrono::steady_clock::now();
+    sort(comparison_keys.begin(), comparison_keys.end(), [](const ordering_key_entry& first_entry, const ordering_key_entry& second_entry) {
+        return first_entry.key_bits < second_entry.key_bits;
+    });
+    double comparison_sort_cost = elapsed_nanoseconds(phase_start) / 1e6;
+    benchmark_checksum += ordering_keys.front().option_index + comparison_keys.front().option_index;
+    vector<ordering_key_entry>().swap(ordering_keys);
+    vector<ordering_key_entry>().swap(comparison_keys);
+    
+    // Physical spins: plain draw, closed-form stopping angle and full integration
+    const int physics_rounds = 2000000;
+    const int integrated_rounds = 20000;
+    physical_wheel benchmark_spin_wheel;
+    build_physical_wheel(benchmark_spin_wheel, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0});
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < physics_rounds; round_index++) {
+        benchmark_checksum += map_random_word_to_index(next_benchmark_word(), 8);
+    }
+    double plain_draw_cost = elapsed_nanoseconds(phase_start) / physics_rounds;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < physics_rounds; round_index++) {
+        benchmark_checksum += locate_physical_sector(benchmark_spin_wheel, compute_stopping_angle(launch_physical_spin(next_benchmark_word())));
+    }
+    double closed_form_cost = elapsed_nanoseconds(phase_start) / physics_rounds;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < integrated_rounds; round_index++) {
+        physical_spin_state benchmark_spin = launch_physical_spin(next_benchmark_word());
+        while (advance_physical_spin(benchmark_spin)) {
+        }
+        benchmark_checksum += locate_physical_sector(benchmark_spin_wheel, static_cast<uint32_t>(benchmark_spin.wheel_angle));
+    }
+    double integrated_spin_cost = elapsed_nanoseconds(phase_start) / integrated_rounds;
+    
+    // Sector resolution on a large uneven wheel: bucket table against a full binary search
+    const int sector_lookup_rounds = 2000000;
+    vector<double> lookup_weights(4096);
+    for (double& lookup_weight : lookup_weights) {
+        lookup_weight = 1.0 + static_cast<double>(next_benchmark_word() % 100);
+    }
+    physical_wheel lookup_spin_wheel;
+    build_physical_wheel(lookup_spin_wheel, lookup_weights);
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < sector_lookup_rounds; round_index++) {
+        benchmark_checksum += locate_physical_sector(lookup_spin_wheel, static_cast<uint32_t>(next_benchmark_word()));
+    }
+    double table_lookup_cost = elapsed_nanoseconds(phase_start) / sector_lookup_rounds;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < sector_lookup_rounds; round_index++) {
+        benchmark_checksum += upper_bound(lookup_spin_wheel.sector_starts.begin(), lookup_spin_wheel.sector_starts.end(),
+                                          static_cast<uint32_t>(next_benchmark_word())) - lookup_spin_wheel.sector_starts.begin();
+    }
+    double binary_search_cost = elapsed_nanoseconds(phase_start) / sector_lookup_rounds;
+    
+    // Wheel images: rasterization and QOI encoding of an 8-sector wheel
+    const int image_rounds = 200;
+    vector<string> image_labels;
+    for (int label_index = 1; label_index <= 8; label_index++) {
+        image_labels.push_back("Option " + to_string(label_index));
+    }
+    raster_image benchmark_image;
+    vector<uint8_t> encoded_image;
+    size_t encoded_image_length = 0;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < image_rounds; round_index++) {
+        render_wheel_image(benchmark_image, image_labels, benchmark_spin_wheel, static_cast<uint32_t>(next_benchmark_word()), 0);
+    }
+    double image_render_cost = elapsed_nanoseconds(phase_start) / image_rounds / 1e3;
+    phase_start = chrono::steady_clock::now();
+    for (int round_index = 0; round_index < image_rounds; round_index++) {
+        encoded_image_length = encode_qoi_image(benchmark_image, encoded_image);
+    }
+    double image_encode_cost = elapsed_nanoseconds(phase_start) / image_rounds / 1e3;
+    benchmark_checksum += encoded_image_length;
+    
+    cout << "Generator Throughput (nanoseconds per 64-bit word):" << endl;
+    cout << "- MT19937-64: " << fixed << setprecision(2) << fast_word_cost << endl;
+    cout << "- ChaCha20 (" << CHACHA20_PARALLEL_BLOCKS << " interleaved blocks): " << secure_word_cost
+         << " (" << setprecision(1) << secure_word_cost / fast_word_cost << "x)" << endl;
+    cout << "Keyed Assignment (16 options, rendezvous): " << setprecision(2)
+         << selection_keys.size() / keyed_batch_seconds / 1e6 << " million keys/s" << endl;
+    cout << "Fair Rotation Pick (" << rotation_option_count << " options): " << rotation_pick_cost << " ns" << endl;
+    cout << "Spin on " << decay_option_count << " options: static " << static_tree_cost
+         << " ns, decaying " << decayed_tree_cost << " ns" << endl;
+    cout << "Tag Filter 'region:eu AND NOT paused' (" << tagged_option_count << " options, "
+         << count_bitmap_values(catalog_matches) << " matches): evaluate + index " << filter_build_cost
+         << " ms, spin " << filtered_spin_cost << " ns" << endl;
+    cout << "Full Shuffle (" << shuffle_option_count << " labels): std::shuffle " << standard_shuffle_cost
+         << " ms, MergeShuffle 1 thread " << merge_single_cost << " ms, " << shuffle_threads << " threads "
+         << merge_parallel_cost << " ms, identical order " << (shuffle_reproducible ? "yes" : "NO") << endl;
+    cout << "Weighted Ordering (" << ordering_option_count << " options): keys " << key_generation_cost
+         << " ms, radix sort " << radix_sort_cost << " ms (std::sort " << comparison_sort_cost << " ms)" << endl;
+    cout << "Physical Spin (8 weighted sectors): plain draw " << plain_draw_cost << " ns, closed form "
+         << closed_form_cost << " ns, integrated " << integrated_spin_cost << " ns" << endl;
+    cout << "Sector Lookup (4096 weighted sectors): bucket table " << table_lookup_cost << " ns, binary search "
+         << binary_search_cost << " ns" << endl;
+    cout << "Wheel Image (" << RASTER_IMAGE_WIDTH << "x" << RASTER_IMAGE_HEIGHT << ", 8 sectors): render " << setprecision(1)
+         << image_render_cost << " us, QOI encode " << image_encode_cost << " us (" << encoded_image_length / 1024 << " KiB)" << endl;
+    
+    cout << "Benchmark Checksum: " << benchmark_checksum << endl << endl;
+}
+
+/*
+ * Latency reporting function implementing sorted percentile extraction
+ */
+void display_latency_percentiles(const string& measurement_label, vector<double>& latency_samples) {
+    sort(latency_samples.begin(), latency_samples.end());
+    auto percentile_value = [&latency_samples](double percentile_rank) -> double {
+        size_t sample_index = static_cast<size_t>(percentile_rank / 100.0 * (latency_samples.size() - 1));
+        return latency_samples[sample_index];
+    };
+    
+    cout << "- " << left << setw(24) << measurement_label << fixed << setprecision(0)
+         << " p50 " << setw(6) << percentile_value(50.0)
+         << " p99 " << setw(6) << percentile_value(99.0)
+         << " p99.9 " << setw(7) << percentile_value(99.9)
+         << " max " << latency_samples.back() << endl;
+}
+
+/*
+ * Histogram recording function implementing log-linear bucket indexing
+ * Values below 2048 are exact; above that each power of two holds 1024 buckets
+ */
+void record_latency_value(latency_histogram& histogram, uint64_t latency_value) {
+    size_t bucket_index;
+    if (latency_value < HISTOGRAM_SUB_BUCKET_COUNT) {
+        bucket_index = static_cast<size_t>(latency_value);
+    } else {
+        // Shift the value down until it lands in [1024, 2048)
+        uint64_t magnitude_shift = 0;
+        while ((latency_value >> magnitude_shift) >= HISTOGRAM_SUB_BUCKET_COUNT) {
+            magnitude_shift++;
+        }
+        magnitude_shift = min(magnitude_shift, HISTOGRAM_MAGNITUDE_COUNT);
+        uint64_t sub_bucket = min((latency_value >> magnitude_shift), HISTOGRAM_SUB_BUCKET_COUNT - 1) - HISTOGRAM_SUB_BUCKET_HALF;
+        bucket_index = static_cast<size_t>(HISTOGRAM_SUB_BUCKET_COUNT + (magnitude_shift - 1) * HISTOGRAM_SUB_BUCKET_HALF + sub_bucket);
+    }
+    
+    histogram.bucket_counts[bucket_index]++;
+    histogram.total_count++;
+    histogram.maximum_value = max(histogram.maximum_value, latency_value);
+}
+
+/*
+ * Histogram merge function combining per-thread recordings
+ */
+void merge_latency_histograms(latency_histogram& target_histogram, const latency_histogram& source_histogram) {
+    for (size_t bucket_index = 0; bucket_index < target_histogram.bucket_counts.size(); bucket_index++) {
+        target_histogram.bucket_counts[bucket_index] += source_histogram.bucket_counts[bucket_index];
+    }
+    target_histogram.total_count += source_histogram.total_count;
+    target_histogram.maximum_value = max(target_histogram.maximum_value, source_histogram.maximum_value);
+}
+
+/*
+ * Histogram query function returning the highest value equivalent to a percentile
+ */
+uint64_t query_latency_percentile(const latency_histogram& histogram, double percentile_rank) {
+    uint64_t target_count = static_cast<uint64_t>(ceil(percentile_rank / 100.0 * histogram.total_count));
+    target_count = max<uint64_t>(1, min(target_count, histogram.total_count));
+    
+    uint64_t cumulative_count = 0;
+    for (size_t bucket_index = 0; bucket_index < histogram.bucket_counts.size(); bucket_index++) {
+        cumulative_count += histogram.bucket_counts[bucket_index];
+        if (cumulative_count < target_count) {
+            continue;
+        }
+        if (bucket_index < HISTOGRAM_SUB_BUCKET_COUNT) {
+            return min<uint64_t>(bucket_index, histogram.maximum_value);
+        }
+        // Decode magnitude and sub-bucket back into the bucket's upper edge
+        uint64_t linear_offset = bucket_index - HISTOGRAM_SUB_BUCKET_COUNT;
+        uint64_t magnitude_shift = linear_offset / HISTOGRAM_SUB_BUCKET_HALF + 1;
+        uint64_t sub_bucket = linear_offset % HISTOGRAM_SUB_BUCKET_HALF + HISTOGRAM_SUB_BUCKET_HALF;
+        return min(((sub_bucket + 1) << magnitude_shift) - 1, histogram.maximum_value);
+    }
+    return histogram.maximum_value;
+}
+
+/*
+ * Load generator function implementing concurrent open-loop and closed-loop clients
+ * Open-loop latency is measured from each request's scheduled start to avoid coordinated omission;
+ * issue lag (actual minus scheduled start) and service time are reported separately so client
+ * oversleep and CPU contention are not mistaken for engine latency
+ */
+void execute_load_generator(const wheel_session_configuration& session_configuration) {
+    cout << "PHASE 2: DECISION ENGINE LOAD GENERATOR" << endl;
+    cout << "---------------------------------------" << endl;
+    
+    // All clients share one read-only compiled wheel, as a resident server would
+    compiled_wheel load_wheel;
+    for (size_t option_index = 0; option_index < session_configuration.load_option_count; option_index++) {
+        load_wheel.choice_container.push_back("Load option " + to_string(option_index + 1));
+    }
+    compile_wheel(load_wheel);
+    
+    bool open_loop_mode = session_configuration.load_request_rate > 0;
+    cout << "Clients: " << session_configuration.load_thread_count
+         << " | Requests per client: " << session_configuration.load_request_count
+         << " | Wheel options: " << load_wheel.choice_container.size() << endl;
+    cout << "Mode: " << (open_loop_mode ? "Open loop, " + to_string(session_configuration.load_request_rate) + " requests/s per client"
+                                        : string("Closed loop")) << endl;
+    cout << "Spin mix:";
+    for (uint64_t spins_per_request : session_configuration.load_spin_mix) {
+        cout << " " << spins_per_request;
+    }
+    cout << endl;
+    
+    // More clients than hardware threads makes the clients compete with each other for CPU
+    unsigned hardware_thread_count = thread::hardware_concurrency();
+    if (hardware_thread_count > 0 && session_configuration.load_thread_count > hardware_thread_count) {
+        cout << "WARNING: " << session_configuration.load_thread_count << " clients exceed the " << hardware_thread_count
+             << " hardware threads; latencies include client scheduling contention, not engine capacity" << endl;
+    }
+    cout << endl;
+    
+    vector<latency_histogram> client_histograms(session_configuration.load_thread_count);
+    vector<latency_histogram> client_lag_histograms(session_configuration.load_thread_count);
+    vector<latency_histogram> client_service_histograms(session_configuration.load_thread_count);
+    vector<uint64_t> client_checksums(session_configuration.load_thread_count, 0);
+    vector<thread> client_threads;
+    auto load_start = chrono::steady_clock::now();
+    
+    for (size_t client_index = 0; client_index < session_configuration.load_thread_count; client_index++) {
+        client_threads.emplace_back([&, client_index]() {
+            mt19937_64& client_generator = acquire_thread_local_generator();
+            latency_histogram& histogram = client_histograms[client_index];
+            latency_histogram& lag_histogram = client_lag_histograms[client_index];
+            latency_histogram& service_histogram = client_service_histograms[client_index];
+            chrono::nanoseconds request_interval(open_loop_mode ? 1000000000ULL / session_configuration.load_request_rate : 0);
+            auto client_start = chrono::steady_clock::now();
+            
+            for (uint64_t request_index = 0; request_index < session_configuration.load_request_count; request_index++) {
+                // Open loop waits for the schedule; closed loop issues immediately
+                auto request_start = chrono::steady_clock::now();
+                auto issue_time = request_start;
+                if (open_loop_mode) {
+                    request_start = client_start + request_interval * request_index;
+                    this_thread::sleep_until(request_start - chrono::microseconds(100));
+                    while ((issue_time = chrono::steady_clock::now()) < request_start) {
+                        // Busy-wait the final stretch; sleep granularity would distort the schedule
+                    }
+                    auto issue_lag = chrono::duration_cast<chrono::nanoseconds>(issue_time - request_start);
+                    record_latency_value(lag_histogram, static_cast<uint64_t>(max<int64_t>(0, issue_lag.count())));
+                }
+                
+                uint64_t spins_per_request = session_configuration.load_spin_mix[request_index % session_configuration.load_spin_mix.size()];
+                for (uint64_t spin_index = 0; spin_index < spins_per_request; spin_index++) {
+                    client_checksums[client_index] += select_compiled_wheel_index(load_wheel, client_generator());
+                }
+                
+                auto request_end = chrono::steady_clock::now();
+                auto request_latency = chrono::duration_cast<chrono::nanoseconds>(request_end - request_start);
+                auto service_time = chrono::duration_cast<chrono::nanoseconds>(request_end - issue_time);
+                record_latency_value(histogram, static_cast<uint64_t>(max<int64_t>(0, request_latency.count())));
+                record_latency_value(service_histogram, static_cast<uint64_t>(max<int64_t>(0, service_time.count())));
+            }
+        });
+    }
+    for (thread& client_thread : client_threads) {
+        client_thread.join();
+    }
+    double elapsed_seconds = chrono::duration<double>(chrono::steady_clock::now() - load_start).count();
+    
+    // Merge client histograms into a single latency distribution
+    latency_histogram combined_histogram;
+    latency_histogram combined_lag_histogram;
+    latency_histogram combined_service_histogram;
+    uint64_t combined_checksum = 0;
+    for (size_t client_index = 0; client_index < client_histograms.size(); client_index++) {
+        merge_latency_histograms(combined_histogram, client_histograms[client_index]);
+        merge_latency_histograms(combined_lag_histogram, client_lag_histograms[client_index]);
+        merge_latency_histograms(combined_service_histogram, client_service_histograms[client_index]);
+        combined_checksum += client_checksums[client_index];
+    }
+    
+    auto print_latency_summary = [](const string& summary_title, const latency_histogram& histogram) {
+        cout << summary_title << " (nanoseconds):" << endl;
+        cout << "- p50:   " << query_latency_percentile(histogram, 50.0) << endl;
+        cout << "- p99:   " << query_latency_percentile(histogram, 99.0) << endl;
+        cout << "- p99.9: " << query_latency_percentile(histogram, 99.9) << endl;
+        cout << "- max:   " << histogram.maximum_value << endl;
+    };
+    print_latency_summary(open_loop_mode ? "Request Latency from schedule" : "Request Latency", combined_histogram);
+    if (open_loop_mode) {
+        // Lag belongs to the client; a large lag means the schedule, not the engine, fell behind
+        print_latency_summary("Issue Lag", combined_lag_histogram);
+        print_latency_summary("Service Time", combined_service_histogram);
+    }
+    cout << "Completed Requests: " << combined_histogram.total_count << endl;
+    cout << "Throughput: " << fixed << setprecision(0) << combined_histogram.total_count / elapsed_seconds << " requests/s" << endl;
+    cout << "Load Checksum: " << combined_checksum << endl << endl;
+}
+
+/*
+ * Secure seeding function implementing ChaCha20 key setup from kernel entropy
+ * Uses getrandom where available and the implementation's random_device elsewhere
+ */
+void seed_chacha20_generator(chacha20_generator& secure_generator) {
+    uint32_t key_words[8];
+    bool kernel_seeded = false;
+    
+#if defined(__linux__)
+    kernel_seeded = getrandom(key_words, sizeof(key_words), 0) == static_cast<ssize_t>(sizeof(key_words));
+#endif
+    if (!kernel_seeded) {
+        random_device entropy_source;
+        for (uint32_t& key_word : key_words) {
+            key_word = entropy_source();
+        }
+    }
+    
+    // "expand 32-byte k" constants, key, zero block counter and zero nonce
+    const uint32_t sigma_constants[4] = {0x61707865u, 0x3320646Eu, 0x79622D32u, 0x6B206574u};
+    for (size_t word_index = 0; word_index < 4; word_index++) {
+        secure_generator.input_state[word_index] = sigma_constants[word_index];
+    }
+    for (size_t word_index = 0; word_index < 8; word_index++) {
+        secure_generator.input_state[4 + word_index] = key_words[word_index];
+    }
+    for (size_t word_index = 12; word_index < 16; word_index++) {
+        secure_generator.input_state[word_index] = 0;
+    }
+    secure_generator.buffer_position = CHACHA20_BUFFER_WORDS;
+}
+
+/*
+ * Keystream refill function implementing four interleaved ChaCha20 blocks
+ * Every statement operates on all lanes at once, which compilers map onto SIMD registers
+ */
+void refill_chacha20_buffer(chacha20_generator& secure_generator) {
+    const size_t lane_count = CHACHA20_PARALLEL_BLOCKS;
+    uint32_t working_state[16][lane_count];
+    uint32_t initial_state[16][lane_count];
+    
+    // Each lane receives the shared input with its own 64-bit block counter
+    uint64_t base_counter = (static_cast<uint64_t>(secure_generator.input_state[13]) << 32) | secure_generator.input_state[12];
+    for (size_t word_index = 0; word_index < 16; word_index++) {
+        for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+            initial_state[word_index][lane_index] = secure_generator.input_state[word_index];
+        }
+    }
+    for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+        uint64_t lane_counter = base_counter + lane_index;
+        initial_state[12][lane_index] = static_cast<uint32_t>(lane_counter);
+        initial_state[13][lane_index] = static_cast<uint32_t>(lane_counter >> 32);
+    }
+    memcpy(working_state, initial_state, sizeof(working_state));
+    
+    auto quarter_round = [&working_state](size_t a, size_t b, size_t c, size_t d) {
+        for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+            uint32_t* word_a = &working_state[a][lane_index];
+            uint32_t* word_b = &working_state[b][lane_index];
+            uint32_t* word_c = &working_state[c][lane_index];
+            uint32_t* word_d = &working_state[d][lane_index];
+            *word_a += *word_b; *word_d ^= *word_a; *word_d = (*word_d << 16) | (*word_d >> 16);
+            *word_c += *word_d; *word_b ^= *word_c; *word_b = (*word_b << 12) | (*word_b >> 20);
+            *word_a += *word_b; *word_d ^= *word_a; *word_d = (*word_d << 8) | (*word_d >> 24);
+            *word_c += *word_d; *word_b ^= *word_c; *word_b = (*word_b << 7) | (*word_b >> 25);
+        }
+    };
+    
+    // Twenty rounds: alternating column and diagonal double rounds
+    for (int double_round = 0; double_round < 10; double_round++) {
+        quarter_round(0, 4, 8, 12);
+        quarter_round(1, 5, 9, 13);
+        quarter_round(2, 6, 10, 14);
+        quarter_round(3, 7, 11, 15);
+        quarter_round(0, 5, 10, 15);
+        quarter_round(1, 6, 11, 12);
+        quarter_round(2, 7, 8, 13);
+        quarter_round(3, 4, 9, 14);
+    }
+    
+    // Feed-forward addition, then serialize lane by lane as consecutive blocks
+    for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+        for (size_t word_index = 0; word_index < 16; word_index += 2) {
+            uint32_t low_word = working_state[word_index][lane_index] + initial_state[word_index][lane_index];
+            uint32_t high_word = working_state[word_index + 1][lane_index] + initial_state[word_index + 1][lane_index];
+            secure_generator.buffered_words[lane_index * 8 + word_index / 2] = (static_cast<uint64_t>(high_word) << 32) | low_word;
+        }
+    }
+    
+    base_counter += lane_count;
+    secure_generator.input_state[12] = static_cast<uint32_t>(base_counter);
+    secure_generator.input_state[13] = static_cast<uint32_t>(base_counter >> 32);
+    secure_generator.buffer_position = 0;
+}
+
+/*
+ * Secure word function returning the next 64 bits of buffered keystream
+ */
+uint64_t next_chacha20_word(chacha20_generator& secure_generator) {
+    if (secure_generator.buffer_position == CHACHA20_BUFFER_WORDS) {
+        refill_chacha20_buffer(secure_generator);
+    }
+    uint64_t random_word = secure_generator.buffered_words[secure_generator.buffer_position];
+    
+    // Consumed keystream is erased so a later memory disclosure cannot replay past draws
+    secure_generator.buffered_words[secure_generator.buffer_position++] = 0;
+    return random_word;
+}
+
+/*
+ * Stream fork function implementing independent ChaCha20 keystreams per parallel task
+ * Tasks share the parent key and take (level, index) as their nonce, so no two overlap
+ */
+void fork_chacha20_generator(const chacha20_generator& secure_source, uint32_t stream_level, uint32_t stream_index, chacha20_generator& task_generator) {
+    memcpy(task_generator.input_state, secure_source.input_state, sizeof(task_generator.input_state));
+    
+    // Zero block counter; the nonce level is offset by one so the parent's zero nonce stays unused
+    task_generator.input_state[12] = 0;
+    task_generator.input_state[13] = 0;
+    task_generator.input_state[14] = stream_level + 1;
+    task_generator.input_state[15] = stream_index;
+    task_generator.buffer_position = CHACHA20_BUFFER_WORDS;
 }
 
 /*